@@ -3,6 +3,7 @@
 #include "multi_batch.hpp"
 
 #include <neo/fft.hpp>
+#include <neo/iir.hpp>
 
 #include <neo/config/xsimd.hpp>
 #include <neo/testing/testing.hpp>
@@ -103,6 +104,54 @@ auto biquad(benchmark::State& state) -> void
     }
 }
 
+template<typename Float>
+auto biquad_cascade(benchmark::State& state) -> void
+{
+    auto const num_channels = static_cast<std::size_t>(state.range(0));
+    auto const size         = static_cast<std::size_t>(state.range(1));
+
+    auto signal = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{num_channels, size};
+    for (auto ch{0U}; ch < num_channels; ++ch) {
+        auto const noise = neo::generate_noise_signal<Float>(size, std::random_device{}());
+        for (auto i{0U}; i < size; ++i) {
+            signal(ch, i) = noise(i);
+        }
+    }
+
+    auto filter = neo::iir::biquad_cascade<Float>{num_channels, 4};
+    filter.set_coefficients(0, neo::iir::make_lowpass(Float(48'000), Float(5'000), Float(0.7)));
+
+    for (auto _ : state) {
+        filter(signal.to_mdspan());
+        benchmark::DoNotOptimize(signal(0, 0));
+        benchmark::ClobberMemory();
+    }
+
+    auto const items = int64_t(state.iterations()) * int64_t(size * num_channels);
+    state.SetBytesProcessed(items * sizeof(Float));
+    state.SetItemsProcessed(items);
+}
+
+template<typename Float>
+auto lookahead_biquad_cascade(benchmark::State& state) -> void
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto signal     = neo::generate_noise_signal<Float>(size, std::random_device{}());
+
+    auto filter = neo::iir::lookahead_biquad_cascade<Float>{4};
+    filter.set_coefficients(0, neo::iir::make_lowpass(Float(48'000), Float(5'000), Float(0.7)));
+
+    for (auto _ : state) {
+        filter(signal.to_mdspan());
+        benchmark::DoNotOptimize(signal(0));
+        benchmark::ClobberMemory();
+    }
+
+    auto const items = int64_t(state.iterations()) * int64_t(size);
+    state.SetBytesProcessed(items * sizeof(Float));
+    state.SetItemsProcessed(items);
+}
+
 }  // namespace
 
 static constexpr auto N = 2048 * 1024;
@@ -122,6 +171,13 @@ BENCHMARK(biquad<neo::multi_batch<float, 2>>)->RangeMultiplier(2)->Range(256, N)
 BENCHMARK(biquad<neo::multi_batch<float, 4>>)->RangeMultiplier(2)->Range(256, N);
 BENCHMARK(biquad<neo::multi_batch<float, 8>>)->RangeMultiplier(2)->Range(256, N);
 
+// 4 stages, channels x frames
+BENCHMARK(biquad_cascade<float>)->ArgsProduct({{1, 2, 8, 16}, {4096}});
+BENCHMARK(biquad_cascade<double>)->ArgsProduct({{1, 2, 8, 16}, {4096}});
+
+BENCHMARK(lookahead_biquad_cascade<float>)->Arg(4096);
+BENCHMARK(lookahead_biquad_cascade<double>)->Arg(4096);
+
 // BENCHMARK(biquad<std::float32_t>)->RangeMultiplier(2)->Range(256, N);
 // BENCHMARK(biquad<std::float64_t>)->RangeMultiplier(2)->Range(256, N);
 // BENCHMARK(biquad<std::float128_t>)->RangeMultiplier(2)->Range(256, N);
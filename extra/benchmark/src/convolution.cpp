@@ -44,6 +44,28 @@ auto conv(benchmark::State& state) -> void
     state.SetBytesProcessed(items * sizeof(Real));
 }
 
+template<neo::convolution::method Method>
+auto convolve(benchmark::State& state) -> void
+{
+    auto const signal_size = static_cast<std::size_t>(state.range(0));
+    auto const patch_size  = static_cast<std::size_t>(state.range(1));
+
+    auto const signal = neo::generate_noise_signal<float>(signal_size, std::random_device{}());
+    auto const patch  = neo::generate_noise_signal<float>(patch_size, std::random_device{}());
+    auto output       = stdex::mdarray<float, stdex::dextents<size_t, 1>>{signal_size + patch_size - 1};
+
+    for (auto _ : state) {
+        neo::convolution::convolve(signal.to_mdspan(), patch.to_mdspan(), output.to_mdspan(), Method);
+
+        benchmark::DoNotOptimize(output(0));
+        benchmark::ClobberMemory();
+    }
+
+    auto const items = static_cast<int64_t>(state.iterations()) * signal_size;
+    state.SetItemsProcessed(items);
+    state.SetBytesProcessed(items * sizeof(float));
+}
+
 constexpr auto const min_block  = 4096;
 constexpr auto const max_block  = 4096;
 constexpr auto const min_filter = 1 << 11;
@@ -63,4 +85,16 @@ BENCHMARK(conv<neo::convolution::split_upola_convolver<std::complex<float>>>)
 BENCHMARK(conv<neo::convolution::split_upols_convolver<std::complex<float>>>)
     ->ArgsProduct({benchmark::CreateRange(min_block, max_block, 2), benchmark::CreateRange(min_filter, max_filter, 2)});
 
+// Crossover points for the default cost_model of neo::convolution::select_method
+BENCHMARK(convolve<neo::convolution::method::automatic>)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 8), benchmark::CreateRange(1 << 2, 1 << 14, 4)});
+BENCHMARK(convolve<neo::convolution::method::direct>)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 8), benchmark::CreateRange(1 << 2, 1 << 14, 4)});
+BENCHMARK(convolve<neo::convolution::method::fft>)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 8), benchmark::CreateRange(1 << 2, 1 << 14, 4)});
+BENCHMARK(convolve<neo::convolution::method::ols>)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 8), benchmark::CreateRange(1 << 2, 1 << 14, 4)});
+BENCHMARK(convolve<neo::convolution::method::upols>)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 8), benchmark::CreateRange(1 << 2, 1 << 14, 4)});
+
 BENCHMARK_MAIN();
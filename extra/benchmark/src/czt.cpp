@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MIT
+
+#include <neo/fft.hpp>
+
+#include <neo/testing/testing.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// 1 Hz bins from 50 to 70 Hz of one second at 48 kHz
+constexpr auto sample_rate = 48'000.0;
+constexpr auto size        = 48'000zu;
+constexpr auto num_points  = 21zu;
+
+template<typename Float>
+auto czt(benchmark::State& state) -> void
+{
+    auto const noise = neo::generate_noise_signal<Float>(size, std::random_device{}());
+
+    auto plan   = neo::fft::czt_plan<std::complex<Float>>{size, num_points, 50.0 / sample_rate, 1.0 / sample_rate};
+    auto output = stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 1>>{num_points};
+
+    for (auto _ : state) {
+        plan(noise.to_mdspan(), output.to_mdspan());
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+// Zero padded to 2^22, which gives bins of about 0.01 Hz
+template<typename Float>
+auto zero_padded_rfft(benchmark::State& state) -> void
+{
+    auto const noise = neo::generate_noise_signal<Float>(size, std::random_device{}());
+
+    auto plan   = neo::fft::rfft_plan<Float>{neo::fft::from_order, 22};
+    auto input  = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{plan.size()};
+    auto output = stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 1>>{plan.size() / 2zu + 1zu};
+
+    for (auto _ : state) {
+        neo::copy(noise.to_mdspan(), stdex::submdspan(input.to_mdspan(), std::tuple{0zu, size}));
+        neo::fft::rfft(plan, input.to_mdspan(), output.to_mdspan());
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template<typename Float>
+auto dft(benchmark::State& state) -> void
+{
+    auto const length = static_cast<std::size_t>(state.range(0));
+    auto const noise  = neo::generate_noise_signal<std::complex<Float>>(length, std::random_device{}());
+
+    auto plan = neo::fft::fallback_dft_plan<std::complex<Float>>{length};
+    auto buf  = noise;
+
+    for (auto _ : state) {
+        neo::fft::dft(plan, buf.to_mdspan());
+        benchmark::DoNotOptimize(buf.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * length));
+}
+
+}  // namespace
+
+BENCHMARK(czt<float>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(czt<double>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(zero_padded_rfft<float>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(zero_padded_rfft<double>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(dft<float>)->Arg(1000)->Arg(48'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(dft<double>)->Arg(1000)->Arg(48'000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: MIT
+
+#include <neo/fft.hpp>
+
+#include <neo/testing/testing.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace {
+
+constexpr auto size = 4096zu;
+
+template<typename Float>
+auto goertzel(benchmark::State& state) -> void
+{
+    auto const num_bins = static_cast<std::size_t>(state.range(0));
+    auto const noise    = neo::generate_noise_signal<Float>(size, std::random_device{}());
+
+    auto bins = std::vector<Float>(num_bins);
+    for (auto k{0zu}; k < num_bins; ++k) {
+        bins[k] = static_cast<Float>(k * 7zu + 3zu);
+    }
+
+    auto plan   = neo::fft::goertzel_plan<Float>{size, stdex::mdspan{bins.data(), stdex::extents{num_bins}}};
+    auto output = stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 1>>{num_bins};
+
+    for (auto _ : state) {
+        plan(noise.to_mdspan(), output.to_mdspan());
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template<typename Float>
+auto rfft(benchmark::State& state) -> void
+{
+    auto const noise = neo::generate_noise_signal<Float>(size, std::random_device{}());
+
+    auto plan   = neo::fft::rfft_plan<Float>{neo::fft::from_order, neo::fft::next_order(size)};
+    auto output = stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 1>>{size / 2zu + 1zu};
+
+    for (auto _ : state) {
+        neo::fft::rfft(plan, noise.to_mdspan(), output.to_mdspan());
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template<typename Float>
+auto sliding_dft(benchmark::State& state) -> void
+{
+    auto const num_bins = static_cast<std::size_t>(state.range(0));
+    auto const noise    = neo::generate_noise_signal<Float>(size, std::random_device{}());
+
+    auto bins = std::vector<std::size_t>(num_bins);
+    for (auto k{0zu}; k < num_bins; ++k) {
+        bins[k] = k * 7zu + 3zu;
+    }
+
+    auto sdft = neo::fft::sliding_dft<Float>{size, stdex::mdspan{bins.data(), stdex::extents{num_bins}}};
+
+    for (auto _ : state) {
+        sdft(noise.to_mdspan());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+}  // namespace
+
+BENCHMARK(goertzel<float>)->RangeMultiplier(2)->Range(1, 64);
+BENCHMARK(goertzel<double>)->RangeMultiplier(2)->Range(1, 64);
+BENCHMARK(rfft<float>);
+BENCHMARK(rfft<double>);
+BENCHMARK(sliding_dft<float>)->RangeMultiplier(2)->Range(1, 64);
+BENCHMARK(sliding_dft<double>)->RangeMultiplier(2)->Range(1, 64);
+
+BENCHMARK_MAIN();
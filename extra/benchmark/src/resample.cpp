@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MIT
+
+#include <neo/convolution.hpp>
+
+#include <neo/testing/testing.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// Ten seconds of stereo at 48 kHz
+constexpr auto num_channels = 2zu;
+constexpr auto size         = 480'000zu;
+
+template<typename Float>
+auto make_signal()
+{
+    auto const noise = neo::generate_noise_signal<Float>(num_channels * size, std::random_device{}());
+
+    auto signal = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{num_channels, size};
+    for (auto i{0zu}; i < noise.extent(0); ++i) {
+        signal.data()[i] = noise(i);
+    }
+    return signal;
+}
+
+template<typename Float>
+auto resample(benchmark::State& state) -> void
+{
+    auto const up     = static_cast<std::size_t>(state.range(0));
+    auto const down   = static_cast<std::size_t>(state.range(1));
+    auto const signal = make_signal<Float>();
+
+    for (auto _ : state) {
+        auto output = neo::convolution::resample(signal.to_mdspan(), up, down);
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_channels * size));
+}
+
+// Zero stuffing, filtering with the same filter in the frequency domain & decimating
+template<typename Float>
+auto convolve_decimate(benchmark::State& state) -> void
+{
+    auto const signal    = make_signal<Float>();
+    auto const resampler = neo::convolution::polyphase_resampler<Float>{
+        static_cast<std::size_t>(state.range(0)),
+        static_cast<std::size_t>(state.range(1)),
+    };
+
+    auto const up      = resampler.up();
+    auto const down    = resampler.down();
+    auto const taps    = resampler.taps_per_phase();
+    auto const phases  = resampler.phases();
+    auto const length  = taps * up;
+    auto const outputs = (size * up + down - 1zu) / down;
+
+    auto filter = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{num_channels, length};
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        for (auto j{0zu}; j < length; ++j) {
+            filter(ch, j) = phases(j % up, taps - 1zu - j / up);
+        }
+    }
+
+    for (auto _ : state) {
+        auto stuffed = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{num_channels, size * up};
+        for (auto ch{0zu}; ch < num_channels; ++ch) {
+            for (auto i{0zu}; i < size; ++i) {
+                stuffed(ch, i * up) = signal(ch, i);
+            }
+        }
+
+        auto const filtered = neo::convolution::offline_convolve(stuffed.to_mdspan(), filter.to_mdspan());
+        auto output         = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{num_channels, outputs};
+        for (auto ch{0zu}; ch < num_channels; ++ch) {
+            for (auto m{0zu}; m < outputs; ++m) {
+                output(ch, m) = filtered(ch, length / 2zu + m * down);
+            }
+        }
+
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_channels * size));
+}
+
+template<typename Float>
+auto polyphase_resampler(benchmark::State& state) -> void
+{
+    auto const block_size = static_cast<std::size_t>(state.range(0));
+    auto const noise      = neo::generate_noise_signal<Float>(block_size, std::random_device{}());
+
+    auto resampler = neo::convolution::polyphase_resampler<Float>{160, 147};
+    auto output    = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{block_size * 2zu};
+
+    for (auto _ : state) {
+        resampler(noise.to_mdspan(), output.to_mdspan());
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * block_size));
+}
+
+}  // namespace
+
+BENCHMARK(resample<float>)
+    ->Args({160, 147})
+    ->Args({147, 160})
+    ->Args({2, 1})
+    ->Args({4, 1})
+    ->Args({1, 2})
+    ->Args({1, 8})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(convolve_decimate<float>)->Args({2, 1})->Args({1, 2})->Args({1, 8})->Unit(benchmark::kMillisecond);
+
+BENCHMARK(polyphase_resampler<float>)->RangeMultiplier(4)->Range(64, 4096);
+
+BENCHMARK_MAIN();
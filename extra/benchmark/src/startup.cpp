@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MIT
+
+#include <neo/fft.hpp>
+#include <neo/math.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <complex>
+
+namespace {
+
+template<typename Plan, bool FromOrder = true>
+auto make_plan(benchmark::State& state) -> void
+{
+    auto const order = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        if constexpr (FromOrder) {
+            auto plan = Plan{neo::fft::from_order, order};
+            benchmark::DoNotOptimize(&plan);
+        } else {
+            // Non power of two, the worst case for the plans taking a size
+            auto plan = Plan{(1zu << order) - 1zu};
+            benchmark::DoNotOptimize(&plan);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+template<typename Float, typename Window>
+auto make_window(benchmark::State& state) -> void
+{
+    auto const size = 1zu << static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        auto window = neo::generate_window<Float, Window>(size);
+        benchmark::DoNotOptimize(window.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+template<typename Float>
+auto sincos(benchmark::State& state) -> void
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto angles     = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+    auto sin        = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+    auto cos        = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+    for (auto i{0zu}; i < size; ++i) {
+        angles(i) = static_cast<Float>(i) * Float(0.001);
+    }
+
+    for (auto _ : state) {
+        neo::sincos(angles.to_mdspan(), sin.to_mdspan(), cos.to_mdspan());
+        benchmark::DoNotOptimize(sin.data());
+        benchmark::DoNotOptimize(cos.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+}
+
+}  // namespace
+
+BENCHMARK(make_plan<neo::fft::fft_plan<std::complex<float>>>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(make_plan<neo::fft::fft_plan<std::complex<double>>>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(make_plan<neo::fft::rfft_plan<float>>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(make_plan<neo::fft::dct2_plan<float>>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(make_plan<neo::fft::mdct_plan<float>>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(make_plan<neo::fft::stft_plan<float>, false>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(make_plan<neo::fft::dft_plan<std::complex<float>>, false>)
+    ->DenseRange(8, 16, 4)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(make_window<float, neo::hann_window<float>>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(make_window<float, neo::blackman_harris_window<float>>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(make_window<float, neo::kaiser_window<float>>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(make_window<float, neo::gaussian_window<float>>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(make_window<float, neo::sine_window<float>>)->DenseRange(8, 16, 4)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(sincos<float>)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
+BENCHMARK(sincos<double>)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
+
+BENCHMARK_MAIN();
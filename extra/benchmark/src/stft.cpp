@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: MIT
+
+#include <neo/fft.hpp>
+#include <neo/parallel.hpp>
+
+#include <neo/testing/testing.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+template<typename Float, bool Parallel>
+auto stft(benchmark::State& state) -> void
+{
+    auto const size        = static_cast<std::size_t>(state.range(0));
+    auto const num_samples = 48'000zu * 60zu;
+    auto const noise       = neo::generate_noise_signal<Float>(num_samples, std::random_device{}());
+    auto const signal      = stdex::mdspan{noise.data(), stdex::extents{1zu, num_samples}};
+
+    auto pool   = neo::thread_pool{};
+    auto plan   = neo::fft::stft_plan<Float>{size};
+    auto output = stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 3>>{
+        1zu,
+        plan.num_frames(num_samples),
+        plan.num_bins(),
+    };
+
+    for (auto _ : state) {
+        if constexpr (Parallel) {
+            plan(signal, output.to_mdspan(), pool);
+        } else {
+            plan(signal, output.to_mdspan());
+        }
+
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["frames"] = benchmark::Counter(
+        static_cast<double>(output.extent(1) * static_cast<size_t>(state.iterations())),
+        benchmark::Counter::kIsRate
+    );
+}
+
+}  // namespace
+
+BENCHMARK(stft<float, false>)->RangeMultiplier(2)->Range(1 << 9, 1 << 12)->Unit(benchmark::kMillisecond);
+BENCHMARK(stft<float, true>)->RangeMultiplier(2)->Range(1 << 9, 1 << 12)->Unit(benchmark::kMillisecond);
+BENCHMARK(stft<double, false>)->RangeMultiplier(2)->Range(1 << 9, 1 << 12)->Unit(benchmark::kMillisecond);
+BENCHMARK(stft<double, true>)->RangeMultiplier(2)->Range(1 << 9, 1 << 12)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -6,6 +6,7 @@
 #include <neo/container.hpp>
 #include <neo/convolution.hpp>
 #include <neo/math.hpp>
+#include <neo/parallel.hpp>
 
 #include <cstdio>
 #include <cstdlib>
@@ -21,40 +22,55 @@ using split_upola_convolver_f16 = conv::uniform_partitioned_convolver<
 #endif
 
 template<typename Convolver>
-[[nodiscard]] static auto
-convolve(neo::audio_buffer<float> const& signal, neo::audio_buffer<float> const& impulse, int block_size = 512)
-    -> neo::audio_buffer<float>
+[[nodiscard]] static auto convolve(
+    neo::audio_buffer<float> const& signal,
+    neo::audio_buffer<float> const& impulse,
+    neo::thread_pool& pool,
+    int block_size = 512
+) -> neo::audio_buffer<float>
 {
     auto impulse_copy = impulse;
     conv::normalize_impulse(impulse_copy.to_mdspan());
     auto const partitions = conv::uniform_partition(impulse_copy.to_mdspan(), static_cast<size_t>(block_size));
 
-    auto output       = neo::audio_buffer<float>{signal.extent(0), signal.extent(1)};
-    auto block_buffer = stdex::mdarray<float, stdex::dextents<size_t, 1>>(size_t(block_size));
+    auto convolver = conv::multichannel_convolver<Convolver>{};
+    convolver.filter(partitions.to_mdspan());
 
-    for (auto channel{0}; std::cmp_less(channel, signal.extent(0)); ++channel) {
-        auto convolver  = Convolver{};
-        auto const full = stdex::full_extent;
-        convolver.filter(stdex::submdspan(partitions.to_mdspan(), channel, full, full));
+    auto output       = neo::audio_buffer<float>{signal.extent(0), signal.extent(1)};
+    auto block_buffer = stdex::mdarray<float, stdex::dextents<size_t, 2>>(signal.extent(0), size_t(block_size));
 
-        for (auto i{0}; std::cmp_less(i, output.extent(1)); i += block_size) {
-            neo::fill(block_buffer.to_mdspan(), 0.0F);
+    for (auto i{0}; std::cmp_less(i, output.extent(1)); i += block_size) {
+        neo::fill(block_buffer.to_mdspan(), 0.0F);
 
-            auto const num_samples   = std::min(static_cast<int>(output.extent(1)) - i, block_size);
-            auto const input_block   = stdex::submdspan(signal.to_mdspan(), channel, std::tuple{i, i + num_samples});
-            auto const process_block = stdex::submdspan(block_buffer.to_mdspan(), std::tuple{0, num_samples});
-            neo::copy(input_block, process_block);
+        auto const full          = stdex::full_extent;
+        auto const num_samples   = std::min(static_cast<int>(output.extent(1)) - i, block_size);
+        auto const input_block   = stdex::submdspan(signal.to_mdspan(), full, std::tuple{i, i + num_samples});
+        auto const process_block = stdex::submdspan(block_buffer.to_mdspan(), full, std::tuple{0, num_samples});
+        neo::copy(input_block, process_block);
 
-            convolver(block_buffer.to_mdspan());
+        // All channels run in parallel
+        convolver(block_buffer.to_mdspan(), pool);
 
-            auto const output_block = stdex::submdspan(output.to_mdspan(), channel, std::tuple{i, i + num_samples});
-            neo::copy(process_block, output_block);
-        }
+        auto const output_block = stdex::submdspan(output.to_mdspan(), full, std::tuple{i, i + num_samples});
+        neo::copy(process_block, output_block);
     }
 
     return output;
 }
 
+[[nodiscard]] static auto
+convolve_offline(neo::audio_buffer<float> const& signal, neo::audio_buffer<float> const& impulse)
+    -> neo::audio_buffer<float>
+{
+    auto impulse_copy = impulse;
+    conv::normalize_impulse(impulse_copy.to_mdspan());
+
+    auto convolver = conv::offline_convolver<float>{signal.extent(1), impulse.extent(1)};
+    auto output    = neo::audio_buffer<float>{signal.extent(0), convolver.output_size()};
+    convolver(signal.to_mdspan(), impulse_copy.to_mdspan(), output.to_mdspan());
+    return output;
+}
+
 auto main(int argc, char** argv) -> int
 {
     auto const args = std::span<char const* const>{argv, size_t(argc)};
@@ -65,7 +81,7 @@ auto main(int argc, char** argv) -> int
     }
 
     auto const [signal, signal_sr]   = neo::load_wav_file<float>(args[1]);
-    auto const [filter, filter_sr]   = neo::load_wav_file<float>(args[2]);
+    auto [filter, filter_sr]         = neo::load_wav_file<float>(args[2]);
     auto const output_length         = signal.extent(1);
     auto const output_length_seconds = static_cast<double>(output_length) / signal_sr;
     auto const block_size            = 8192 * 4;
@@ -75,8 +91,13 @@ auto main(int argc, char** argv) -> int
         return EXIT_FAILURE;
     }
     if (not neo::float_equality::exact(signal_sr, filter_sr)) {
-        std::printf("Sample-rate mismatch: signal = %d filter = %d\n", int(signal_sr), int(filter_sr));
-        return EXIT_FAILURE;
+        std::printf("Resampling filter from %d to %d Hz\n", int(filter_sr), int(signal_sr));
+        auto const [up, down] = conv::resample_factors(filter_sr, signal_sr);
+        auto const resampled  = conv::resample(filter.to_mdspan(), up, down);
+
+        filter    = neo::audio_buffer<float>{resampled.extent(0), resampled.extent(1)};
+        filter_sr = signal_sr;
+        neo::copy(resampled.to_mdspan(), filter.to_mdspan());
     }
 
     std::printf(
@@ -88,7 +109,7 @@ auto main(int argc, char** argv) -> int
     );
 
     std::printf(
-        "Signal: %d channels %d frames (%.2f sec) at %d kHz",
+        "Signal: %d channels %d frames (%.2f sec) at %d kHz\n",
         static_cast<int>(signal.extent(0)),
         static_cast<int>(signal.extent(1)),
         static_cast<double>(signal.extent(1)) / signal_sr,
@@ -97,23 +118,42 @@ auto main(int argc, char** argv) -> int
 
     {
         auto const start   = std::chrono::system_clock::now();
-        auto output        = convolve<conv::upola_convolver<std::complex<float>>>(signal, filter, block_size);
+        auto output        = convolve_offline(signal, filter);
         auto const stop    = std::chrono::system_clock::now();
         auto const runtime = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start);
 
         neo::normalize_peak(output.to_mdspan());
         neo::write_wav_file(output, signal_sr, args[3]);
+        std::printf(
+            "OFFLINE32: %.2f sec / %.1f x real-time\n",
+            runtime.count(),
+            output_length_seconds / runtime.count()
+        );
+    }
+
+    // Real-time convolvers for comparison, their output is truncated to the signal length
+    auto pool = neo::thread_pool{};
+
+    {
+        auto const start   = std::chrono::system_clock::now();
+        auto output        = convolve<conv::upola_convolver<std::complex<float>>>(signal, filter, pool, block_size);
+        auto const stop    = std::chrono::system_clock::now();
+        auto const runtime = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start);
+
         std::printf("UPOLA32: %.2f sec / %.1f x real-time\n", runtime.count(), output_length_seconds / runtime.count());
     }
 
     {
         auto const start   = std::chrono::system_clock::now();
-        auto output        = convolve<conv::split_upola_convolver<std::complex<float>>>(signal, filter, block_size);
+        auto output        = convolve<conv::split_upola_convolver<std::complex<float>>>(
+            signal,
+            filter,
+            pool,
+            block_size
+        );
         auto const stop    = std::chrono::system_clock::now();
         auto const runtime = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start);
 
-        neo::normalize_peak(output.to_mdspan());
-        neo::write_wav_file(output, signal_sr, args[3]);
         std::printf(
             "SPLIT_UPOLA32: %.2f sec / %.1f x real-time\n",
             runtime.count(),
@@ -124,12 +164,10 @@ auto main(int argc, char** argv) -> int
 #if defined(NEO_HAS_BUILTIN_FLOAT16)
     {
         auto const start   = std::chrono::system_clock::now();
-        auto output        = convolve<split_upola_convolver_f16<std::complex<float>>>(signal, filter, block_size);
+        auto output        = convolve<split_upola_convolver_f16<std::complex<float>>>(signal, filter, pool, block_size);
         auto const stop    = std::chrono::system_clock::now();
         auto const runtime = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start);
 
-        neo::normalize_peak(output.to_mdspan());
-        neo::write_wav_file(output, signal_sr, args[3]);
         std::printf(
             "SPLIT_UPOLA16: %.2f sec / %.1f x real-time\n",
             runtime.count(),
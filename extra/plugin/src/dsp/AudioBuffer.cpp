@@ -2,6 +2,8 @@
 
 #include "AudioBuffer.hpp"
 
+#include <neo/convolution/polyphase_resampler.hpp>
+
 #include <algorithm>
 #include <cmath>
 #include <numeric>
@@ -10,26 +12,26 @@ namespace neo {
 
 auto resample(BufferWithSampleRate<float> const& buf, double destSampleRate) -> BufferWithSampleRate<float>
 {
-    if (juce::exactlyEqual(buf.sampleRate, destSampleRate)) {
+    // Hosts may report fractional rates, resample_factors only accepts positive integers
+    auto const from = std::max(std::round(buf.sampleRate), 1.0);
+    auto const to   = std::max(std::round(destSampleRate), 1.0);
+    if (juce::exactlyEqual(from, to)) {
         return buf;
     }
 
-    auto const factorReading = buf.sampleRate / destSampleRate;
-
-    auto original     = buf;
-    auto memorySource = juce::MemoryAudioSource(original.buffer, false);
-
-    auto const finalSize = juce::roundToInt(juce::jmax(1.0, buf.buffer.getNumSamples() / factorReading));
+    auto const [up, down] = convolution::resample_factors(from, to);
+    auto const input      = to_mdarray(buf.buffer);
+    auto const output     = convolution::resample(input.to_mdspan(), up, down);
 
     auto result = BufferWithSampleRate<float>{
-        .buffer     = juce::AudioBuffer<float>{buf.buffer.getNumChannels(), finalSize},
+        .buffer     = juce::AudioBuffer<float>{buf.buffer.getNumChannels(), static_cast<int>(output.extent(1))},
         .sampleRate = destSampleRate,
     };
 
-    auto resampler = juce::ResamplingAudioSource(&memorySource, false, buf.buffer.getNumChannels());
-    resampler.setResamplingRatio(factorReading);
-    resampler.prepareToPlay(finalSize, buf.sampleRate);
-    resampler.getNextAudioBlock({&result.buffer, 0, result.buffer.getNumSamples()});
+    for (auto ch{0}; ch < result.buffer.getNumChannels(); ++ch) {
+        auto const row = stdex::submdspan(output.to_mdspan(), static_cast<std::size_t>(ch), stdex::full_extent);
+        result.buffer.copyFrom(ch, 0, row.data_handle(), result.buffer.getNumSamples());
+    }
 
     return result;
 }
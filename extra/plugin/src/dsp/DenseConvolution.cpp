@@ -5,12 +5,8 @@
 #include "dsp/AudioBuffer.hpp"
 
 #include <neo/convolution/normalize_impulse.hpp>
+#include <neo/convolution/sparsity.hpp>
 #include <neo/convolution/uniform_partition.hpp>
-#include <neo/fft/rfftfreq.hpp>
-#include <neo/math/a_weighting.hpp>
-#include <neo/unit/decibel.hpp>
-
-#include <bit>
 
 namespace neo {
 
@@ -108,20 +104,6 @@ auto DenseConvolution::updateImpulseResponse() -> void
     }
 }
 
-[[nodiscard]] static auto
-normalization_factor(stdex::mdspan<std::complex<float> const, stdex::dextents<size_t, 2>> filter) -> float
-{
-    auto maxPower = 0.0F;
-    for (auto p{0UL}; p < filter.extent(0); ++p) {
-        auto const partition = stdex::submdspan(filter, p, stdex::full_extent);
-        for (auto bin{0UL}; bin < filter.extent(1); ++bin) {
-            auto const amplitude = std::abs(partition(bin));
-            maxPower             = std::max(maxPower, amplitude * amplitude);
-        }
-    }
-    return 1.0F / maxPower;
-}
-
 auto sparse_convolve(
     juce::AudioBuffer<float> const& signal,
     juce::AudioBuffer<float> const& filter,
@@ -137,37 +119,19 @@ auto sparse_convolve(
     neo::convolution::normalize_impulse(matrix.to_mdspan());
     auto partitions = neo::convolution::uniform_partition(matrix.to_mdspan(), static_cast<std::size_t>(blockSize));
 
-    auto const K = std::bit_ceil((partitions.extent(2) - 1zu) * 2zu);
-
-    auto const weights = [K, bins = partitions.extent(2), lowBinsToKeep, sampleRate] {
-        jassert(std::cmp_less(lowBinsToKeep, bins));
-
-        auto w = std::vector<float>(bins);
-        std::fill(w.begin(), std::next(w.begin(), lowBinsToKeep), 100.0F);
-
-        for (auto i{lowBinsToKeep}; i < std::ssize(w); ++i) {
-            auto const frequency = neo::rfftfreq<float>(K, i, 1.0 / sampleRate);
-            auto const weight    = neo::a_weighting(frequency);
-
-            w[static_cast<std::size_t>(i)] = weight;
-        }
-        return w;
-    }();
-
     for (auto ch{0}; ch < signal.getNumChannels(); ++ch) {
         auto convolver               = neo::convolution::sparse_upola_convolver<std::complex<float>>{};
         auto const channel           = static_cast<size_t>(ch);
         auto const full              = stdex::full_extent;
         auto const channelPartitions = stdex::submdspan(partitions.to_mdspan(), channel, full, full);
 
-        auto const scale = normalization_factor(channelPartitions);
-
-        auto const isAboveThreshold = [thresholdDB, scale, &weights](auto /*row*/, auto col, auto bin) {
-            auto const gain  = std::abs(bin);
-            auto const power = gain * gain;
-            auto const dB    = amplitude_to_db(power * scale) * 0.5F + weights[col];
-            return dB > thresholdDB;
-        };
+        jassert(std::cmp_less(lowBinsToKeep, partitions.extent(2)));
+        auto const isAboveThreshold = neo::convolution::a_weighted_threshold_sparsity(
+            channelPartitions,
+            static_cast<double>(thresholdDB),
+            sampleRate,
+            static_cast<std::size_t>(lowBinsToKeep)
+        );
 
         convolver.filter(channelPartitions, isAboveThreshold);
 
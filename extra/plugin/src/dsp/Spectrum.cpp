@@ -4,47 +4,55 @@
 
 #include "dsp/AudioBuffer.hpp"
 
+#include <neo/algorithm/power.hpp>
+#include <neo/algorithm/scale.hpp>
 #include <neo/unit/decibel.hpp>
 
 #include <juce_dsp/juce_dsp.h>
 
 namespace neo {
 
+namespace {
+
+// 10 * log10(|bin|^2 / max), floored at -72 dB
+[[nodiscard]] auto normalizedPowerDb(stdex::mdspan<std::complex<float> const, stdex::dextents<size_t, 2>> frames)
+    -> stdex::mdarray<float, stdex::dextents<size_t, 2>>
+{
+    auto power = stdex::mdarray<float, stdex::dextents<size_t, 2>>{frames.extent(0), frames.extent(1)};
+    neo::power(frames, power.to_mdspan());
+
+    auto max = 0.0F;
+    for (auto frameIdx{0zu}; frameIdx < power.extent(0); ++frameIdx) {
+        for (auto binIdx{0zu}; binIdx < power.extent(1); ++binIdx) {
+            max = std::max(max, power(frameIdx, binIdx));
+        }
+    }
+
+    neo::scale(1.0F / max, power.to_mdspan());
+    neo::power_to_db<neo::precision::estimate>(power.to_mdspan(), power.to_mdspan(), -72.0F);
+    return power;
+}
+
+}  // namespace
+
 auto powerSpectrumImage(
     stdex::mdspan<std::complex<float> const, stdex::dextents<size_t, 2>> frames,
     std::function<float(std::size_t)> const& weighting,
     float threshold
 ) -> juce::Image
 {
-    auto const scale = [=] {
-        auto max = 0.0F;
-        for (auto frameIdx{0zu}; frameIdx < frames.extent(0); ++frameIdx) {
-            for (auto binIdx{0zu}; binIdx < frames.extent(1); ++binIdx) {
-                auto bin = std::abs(frames(frameIdx, binIdx));
-                max      = std::max(max, bin * bin);
-            }
-        }
-        return 1.0F / max;
-    }();
-
-    auto const fillPixel = [=](auto& img, int x, int y, auto bin) {
-        auto const weight     = weighting(static_cast<std::size_t>(y));
-        auto const power      = bin * bin;
-        auto const normalized = power * scale;
-        auto const dB         = neo::amplitude_to_db(normalized, -144.0F) * 0.5F + weight;
-        auto const color      = dB < threshold ? juce::Colours::white : juce::Colours::black;
-        img.setPixelAt(x, y, color);
-    };
-
     auto const numFrames = static_cast<int>(frames.extent(0));
     auto const numBins   = static_cast<int>(frames.extent(1));
+    auto const power     = normalizedPowerDb(frames);
 
     auto img = juce::Image{juce::Image::PixelFormat::ARGB, numFrames, numBins, true};
 
     for (auto frameIdx{0}; frameIdx < numFrames; ++frameIdx) {
         for (auto binIdx{0}; binIdx < numBins; ++binIdx) {
-            auto const bin = frames(frameIdx, binIdx);
-            fillPixel(img, frameIdx, numBins - binIdx - 1, std::abs(bin));
+            auto const y     = numBins - binIdx - 1;
+            auto const dB    = power(frameIdx, binIdx) + weighting(static_cast<std::size_t>(y));
+            auto const color = dB < threshold ? juce::Colours::white : juce::Colours::black;
+            img.setPixelAt(frameIdx, y, color);
         }
     }
 
@@ -56,29 +64,14 @@ auto powerHistogram(
     std::function<float(std::size_t)> const& weighting
 ) -> std::vector<int>
 {
-
-    auto const scale = [=] {
-        auto max = 0.0F;
-        for (auto frameIdx{0zu}; frameIdx < spectogram.extent(0); ++frameIdx) {
-            for (auto binIdx{0zu}; binIdx < spectogram.extent(1); ++binIdx) {
-                auto const bin = std::abs(spectogram(frameIdx, binIdx));
-                max            = std::max(max, bin * bin);
-            }
-        }
-        return 1.0F / max;
-    }();
-
-    auto histogram = std::vector<int>(144, 0);
-
-    for (auto frameIdx{0zu}; frameIdx < spectogram.extent(0); ++frameIdx) {
-        for (auto binIdx{0zu}; binIdx < spectogram.extent(1); ++binIdx) {
-            auto const weight     = weighting(binIdx);
-            auto const bin        = std::abs(spectogram(frameIdx, binIdx));
-            auto const power      = bin * bin;
-            auto const normalized = power * scale;
-            auto const dB         = neo::amplitude_to_db(normalized, -144.0F) * 0.5F + weight;
-            auto const dBClamped  = std::clamp(dB, -143.0F, 0.0F);
-            auto const index      = static_cast<std::size_t>(juce::roundToInt(std::abs(dBClamped)));
+    auto const power = normalizedPowerDb(spectogram);
+    auto histogram   = std::vector<int>(144, 0);
+
+    for (auto frameIdx{0zu}; frameIdx < power.extent(0); ++frameIdx) {
+        for (auto binIdx{0zu}; binIdx < power.extent(1); ++binIdx) {
+            auto const dB        = power(frameIdx, binIdx) + weighting(binIdx);
+            auto const dBClamped = std::clamp(dB, -143.0F, 0.0F);
+            auto const index     = static_cast<std::size_t>(juce::roundToInt(std::abs(dBClamped)));
             histogram[index] += 1;
         }
     }
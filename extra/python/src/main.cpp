@@ -170,11 +170,15 @@ auto fft(py::array_t<Complex> array, std::optional<std::size_t> n, neo::fft::nor
     });
 }
 
-template<neo::convolution::method Method, std::floating_point Float>
-[[nodiscard]] auto convolve(py::array_t<Float> in1, py::array_t<Float> in2, neo::convolution::mode mode)
-    -> py::array_t<Float>
+template<std::floating_point Float>
+[[nodiscard]] auto convolve(
+    py::array_t<Float> in1,
+    py::array_t<Float> in2,
+    neo::convolution::mode mode,
+    neo::convolution::method method
+) -> py::array_t<Float>
 {
-    if (in1.ndim() != 1 or in1.ndim() != 1) {
+    if (in1.ndim() != 1 or in2.ndim() != 1) {
         throw std::runtime_error{"unsupported dimension: in1 and in2 must be 1-D"};
     }
 
@@ -187,12 +191,7 @@ template<neo::convolution::method Method, std::floating_point Float>
 
         {
             auto no_gil = py::gil_scoped_release{};
-            if constexpr (Method == neo::convolution::method::direct) {
-                neo::convolution::direct_convolve(signal, patch, output_view);
-            } else if constexpr (Method == neo::convolution::method::fft) {
-                auto out = neo::convolution::fft_convolve(signal, patch);
-                neo::copy(out.to_mdspan(), output_view);
-            }
+            neo::convolution::convolve(signal, patch, output_view, method);
         }
 
         return output;
@@ -255,11 +254,8 @@ PYBIND11_MODULE(_neo, m)
     m.def("ifft", &fft<std::complex<float>, neo::fft::direction::backward>);
     m.def("ifft", &fft<std::complex<double>, neo::fft::direction::backward>);
 
-    m.def("direct_convolve", &convolve<neo::convolution::method::direct, float>);
-    m.def("direct_convolve", &convolve<neo::convolution::method::direct, double>);
-
-    m.def("fft_convolve", &convolve<neo::convolution::method::fft, float>);
-    m.def("fft_convolve", &convolve<neo::convolution::method::fft, double>);
+    m.def("convolve", &convolve<float>);
+    m.def("convolve", &convolve<double>);
 
     m.def("amplitude_to_db", py::vectorize(amplitude_to_db<float>));
     m.def("amplitude_to_db", py::vectorize(amplitude_to_db<double>));
@@ -31,6 +31,16 @@ CONVOLUTION_MODE = {
     "same": _neo.convolution_mode.same,
 }
 
+CONVOLUTION_METHOD = {
+    "auto": _neo.convolution_method.automatic,
+    "direct": _neo.convolution_method.direct,
+    "fft": _neo.convolution_method.fft,
+    "ola": _neo.convolution_method.ola,
+    "ols": _neo.convolution_method.ols,
+    "upola": _neo.convolution_method.upola,
+    "upols": _neo.convolution_method.upols,
+}
+
 
 def amplitude_to_db(x, precision="accurate") -> np.ndarray:
     """Convert an amplitude to dB-Scale.
@@ -43,6 +53,4 @@ def amplitude_to_db(x, precision="accurate") -> np.ndarray:
 def convolve(in1: np.ndarray, in2: np.ndarray, mode: str = "full", method: str = "auto") -> np.ndarray:
     """Convolve two 1-dimensional arrays.
     """
-    if method == "fft":
-        return _neo.fft_convolve(in1, in2, CONVOLUTION_MODE[mode])
-    return _neo.direct_convolve(in1, in2, CONVOLUTION_MODE[mode])
+    return _neo.convolve(in1, in2, CONVOLUTION_MODE[mode], CONVOLUTION_METHOD[method])
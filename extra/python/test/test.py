@@ -19,7 +19,7 @@ def test_fft(n, complex):
 
 
 @pytest.mark.parametrize("dtype", [np.float64])
-@pytest.mark.parametrize("method", ["direct", "fft"])
+@pytest.mark.parametrize("method", ["auto", "direct", "fft", "ola", "ols", "upola", "upols"])
 @pytest.mark.parametrize("signal_size", [2, 3, 4, 5, 6, 7, 8, 9, 10, 128, 555])
 @pytest.mark.parametrize("patch_size", [2, 3, 4, 5, 6, 7, 8, 9, 10])
 def test_convolve(dtype, method, signal_size, patch_size):
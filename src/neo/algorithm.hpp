@@ -12,13 +12,16 @@
 #include <neo/algorithm/allclose.hpp>
 #include <neo/algorithm/allmatch.hpp>
 #include <neo/algorithm/copy.hpp>
+#include <neo/algorithm/dot.hpp>
 #include <neo/algorithm/fill.hpp>
+#include <neo/algorithm/magnitude.hpp>
 #include <neo/algorithm/mean.hpp>
 #include <neo/algorithm/mean_squared_error.hpp>
 #include <neo/algorithm/multiply.hpp>
 #include <neo/algorithm/multiply_add.hpp>
 #include <neo/algorithm/normalize_energy.hpp>
 #include <neo/algorithm/normalize_peak.hpp>
+#include <neo/algorithm/power.hpp>
 #include <neo/algorithm/root_mean_squared_error.hpp>
 #include <neo/algorithm/scale.hpp>
 #include <neo/algorithm/standard_deviation.hpp>
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/container/mdspan.hpp>
+#include <neo/simd/native.hpp>
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace neo {
+
+namespace detail {
+
+/// sum_i x[i] * y[i], vectorized with two accumulators
+template<std::floating_point Float>
+[[nodiscard]] auto dot(Float const* NEO_RESTRICT x, Float const* NEO_RESTRICT y, std::size_t size) noexcept -> Float
+{
+    auto i   = 0zu;
+    auto sum = Float(0);
+
+#if defined(NEO_HAS_ISA_SSE2)
+    if constexpr (std::same_as<Float, float> or std::same_as<Float, double>) {
+        using Batch = std::conditional_t<std::same_as<Float, float>, float32x, float64x>;
+
+        static constexpr auto width = Batch::size;
+
+        if (size >= width) {
+            auto acc0 = Batch::broadcast(Float(0));
+            auto acc1 = Batch::broadcast(Float(0));
+            for (; i + width * 2zu <= size; i += width * 2zu) {
+                acc0 = acc0 + Batch::load_unaligned(x + i) * Batch::load_unaligned(y + i);
+                acc1 = acc1 + Batch::load_unaligned(x + i + width) * Batch::load_unaligned(y + i + width);
+            }
+            for (; i + width <= size; i += width) {
+                acc0 = acc0 + Batch::load_unaligned(x + i) * Batch::load_unaligned(y + i);
+            }
+
+            auto lanes = std::array<Float, width>{};
+            (acc0 + acc1).store_unaligned(lanes.data());
+            for (auto lane : lanes) {
+                sum += lane;
+            }
+        }
+    }
+#endif
+
+    for (; i < size; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+}  // namespace detail
+
+/// Inner product \\f$\sum_i x_i y_i\\f$ of two real vectors, contiguous vectors use SIMD
+/// \ingroup neo-linalg
+template<in_vector InVecX, in_vector InVecY>
+    requires(
+        std::floating_point<value_type_t<InVecX>> and std::same_as<value_type_t<InVecX>, value_type_t<InVecY>>
+    )
+[[nodiscard]] auto dot(InVecX x, InVecY y) noexcept -> value_type_t<InVecX>
+{
+    using Float = value_type_t<InVecX>;
+
+    assert(x.extent(0) == y.extent(0));
+
+    auto const size = static_cast<std::size_t>(x.extent(0));
+
+    if constexpr (std::is_pointer_v<typename InVecX::data_handle_type>
+                  and std::is_pointer_v<typename InVecY::data_handle_type>) {
+        if (size == 0 or (x.stride(0) == 1 and y.stride(0) == 1)) {
+            return detail::dot<Float>(x.data_handle(), y.data_handle(), size);
+        }
+    }
+
+    auto sum = Float(0);
+    for (auto i{0zu}; i < size; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+}  // namespace neo
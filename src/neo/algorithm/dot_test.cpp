@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: MIT
+
+#include "dot.hpp"
+
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <array>
+#include <tuple>
+
+TEMPLATE_TEST_CASE("neo/algorithm: dot", "", float, double, long double)
+{
+    using Float = TestType;
+
+    auto const size = GENERATE(as<std::size_t>{}, 0, 1, 3, 8, 17, 128, 1001);
+    CAPTURE(size);
+
+    auto const x = neo::generate_noise_signal<Float>(size * 2zu, Catch::getSeed());
+    auto const y = neo::generate_noise_signal<Float>(size * 2zu, Catch::getSeed() + 1U);
+
+    auto expected = 0.0L;
+    for (auto i{0zu}; i < size; ++i) {
+        expected += static_cast<long double>(x(i)) * static_cast<long double>(y(i));
+    }
+
+    SECTION("contiguous")
+    {
+        auto const xs = stdex::submdspan(x.to_mdspan(), std::tuple{0zu, size});
+        auto const ys = stdex::submdspan(y.to_mdspan(), std::tuple{0zu, size});
+        REQUIRE_THAT(double(neo::dot(xs, ys)), Catch::Matchers::WithinAbs(double(expected), 1e-4));
+    }
+
+    SECTION("strided")
+    {
+        auto const mapping = stdex::layout_stride::mapping{stdex::dextents<std::size_t, 1>{size}, std::array{2zu}};
+        auto const xs      = stdex::submdspan(x.to_mdspan(), std::tuple{0zu, size});
+        auto const ys      = stdex::mdspan{y.data(), mapping};
+
+        auto strided = 0.0L;
+        for (auto i{0zu}; i < size; ++i) {
+            strided += static_cast<long double>(x(i)) * static_cast<long double>(y(i * 2zu));
+        }
+        REQUIRE_THAT(double(neo::dot(xs, ys)), Catch::Matchers::WithinAbs(double(strided), 1e-4));
+    }
+}
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: MIT
+
+#include "magnitude.hpp"
+
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <complex>
+
+TEMPLATE_TEST_CASE("neo/algorithm: magnitude", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const rows = GENERATE(as<std::size_t>{}, 1, 3);
+    auto const cols = GENERATE(as<std::size_t>{}, 1, 7, 128);
+
+    auto const noise = neo::generate_noise_signal<Complex>(rows * cols, Catch::getSeed());
+    auto const x     = stdex::mdspan{noise.data(), stdex::extents{rows, cols}};
+
+    SECTION("vector")
+    {
+        auto const in = stdex::submdspan(x, 0, stdex::full_extent);
+        auto out      = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{cols};
+        neo::magnitude(in, out.to_mdspan());
+
+        for (auto i{0zu}; i < cols; ++i) {
+            auto const z = in[i];
+            REQUIRE_THAT(out(i), Catch::Matchers::WithinAbs(std::abs(z), 0.00001));
+        }
+    }
+
+    SECTION("matrix")
+    {
+        auto out = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{rows, cols};
+        neo::magnitude(x, out.to_mdspan());
+
+        for (auto row{0zu}; row < rows; ++row) {
+            for (auto col{0zu}; col < cols; ++col) {
+                auto const z = x(row, col);
+                REQUIRE_THAT(out(row, col), Catch::Matchers::WithinAbs(std::abs(z), 0.00001));
+            }
+        }
+    }
+}
@@ -5,6 +5,7 @@
 #include <neo/config.hpp>
 
 #include <neo/complex/split_complex.hpp>
+#include <neo/container/block_sparse_matrix.hpp>
 #include <neo/container/csr_matrix.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/simd/native.hpp>
@@ -18,6 +19,7 @@
 #endif
 
 #include <cassert>
+#include <tuple>
 #include <utility>
 
 namespace neo::simd {
@@ -333,6 +335,30 @@ auto multiply_add(
     }
 }
 
+/// Multiply-Add \f$out = x * y[row] + z\f$
+/// \details Each run of contiguous columns is processed with the dense (vectorized) kernel.
+/// \ingroup neo-linalg
+template<typename U, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto multiply_add(
+    in_vector auto x,
+    block_sparse_matrix<U, IndexType, ValueContainer, IndexContainer> const& y,
+    typename block_sparse_matrix<U, IndexType, ValueContainer, IndexContainer>::index_type y_row,
+    in_vector auto z,
+    out_vector auto out
+) noexcept -> void
+{
+    assert(x.extent(0) == y.columns());
+
+    auto const& rrows = y.row_container();
+    auto const& rcols = y.column_container();
+
+    for (auto r{rrows[y_row]}; r < rrows[y_row + 1]; ++r) {
+        auto const values = y.run(r);
+        auto const cols   = std::tuple{rcols[r], rcols[r] + values.extent(0)};
+        multiply_add(stdex::submdspan(x, cols), values, stdex::submdspan(z, cols), stdex::submdspan(out, cols));
+    }
+}
+
 /// Multiply-Add \f$out = x * y + z\f$
 /// \ingroup neo-linalg
 template<in_vector VecX, in_vector VecY, in_vector VecZ, out_vector VecOut>
@@ -11,6 +11,8 @@
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 
+#include <complex>
+
 template<typename Float>
 static auto test_csr_matrix()
 {
@@ -49,6 +51,43 @@ TEMPLATE_TEST_CASE("neo/algorithm: multiply_add(csr_matrix)", "", float, double)
 TEMPLATE_TEST_CASE("neo/algorithm: multiply_add(csr_matrix)", "", _Float16) { test_csr_matrix<TestType>(); }
 #endif
 
+TEMPLATE_TEST_CASE("neo/algorithm: multiply_add(block_sparse_matrix)", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const rows = 8zu;
+    auto const cols = GENERATE(as<std::size_t>{}, 17, 64, 129);
+
+    auto matrix = stdex::mdarray<Complex, stdex::dextents<std::size_t, 2>>{rows, cols};
+    auto x      = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{cols};
+    for (auto col{0zu}; col < cols; ++col) {
+        x(col) = Complex{Float(1) + Float(col) * Float(0.5), Float(2) - Float(col) * Float(0.25)};
+        for (auto row{0zu}; row < rows; ++row) {
+            matrix(row, col) = Complex{Float(row + 1zu), Float(col % 7zu)};
+        }
+    }
+
+    // Runs of varying length with gaps in between
+    auto const keep = [](auto row, auto col, auto) { return ((col + row) / 5zu) % 3zu != 1zu; };
+
+    auto const csr    = neo::csr_matrix<Complex>{matrix.to_mdspan(), keep};
+    auto const sparse = neo::block_sparse_matrix<Complex>{matrix.to_mdspan(), keep};
+
+    auto expected = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{cols};
+    auto actual   = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{cols};
+
+    for (auto row{0zu}; row < rows; ++row) {
+        neo::multiply_add(x.to_mdspan(), csr, row, expected.to_mdspan(), expected.to_mdspan());
+        neo::multiply_add(x.to_mdspan(), sparse, row, actual.to_mdspan(), actual.to_mdspan());
+    }
+
+    for (auto col{0zu}; col < cols; ++col) {
+        REQUIRE(actual(col).real() == Catch::Approx(expected(col).real()));
+        REQUIRE(actual(col).imag() == Catch::Approx(expected(col).imag()));
+    }
+}
+
 TEMPLATE_TEST_CASE("neo/algorithm: multiply_add(split_complex)", "", float, double)
 {
     using Float = TestType;
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/complex/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/math/imag.hpp>
+#include <neo/math/real.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+
+namespace neo {
+
+/// Power \\f$out = |x|^2\\f$ of complex values, without the square root of magnitude
+/// \ingroup neo-linalg
+template<in_object InObj, out_object OutObj>
+    requires(InObj::rank() == OutObj::rank() and complex<value_type_t<InObj>>)
+auto power(InObj x, OutObj out) noexcept -> void
+{
+    using Float = value_type_t<OutObj>;
+
+    assert(detail::extents_equal(x, out));
+
+    if constexpr (InObj::rank() == 1) {
+        for (auto i{0zu}; i < static_cast<std::size_t>(x.extent(0)); ++i) {
+            auto const re = static_cast<Float>(math::real(x[i]));
+            auto const im = static_cast<Float>(math::imag(x[i]));
+            out[i]        = re * re + im * im;
+        }
+    } else {
+        for (auto row{0zu}; row < static_cast<std::size_t>(x.extent(0)); ++row) {
+            power(stdex::submdspan(x, row, stdex::full_extent), stdex::submdspan(out, row, stdex::full_extent));
+        }
+    }
+}
+
+}  // namespace neo
@@ -7,6 +7,9 @@
 
 #include <neo/config.hpp>
 
+#include <neo/container/block_adapter.hpp>
+#include <neo/container/block_sparse_matrix.hpp>
 #include <neo/container/compressed_accessor.hpp>
 #include <neo/container/csr_matrix.hpp>
 #include <neo/container/mdspan.hpp>
+#include <neo/container/spsc_ring_buffer.hpp>
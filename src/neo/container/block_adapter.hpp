@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/algorithm/fill.hpp>
+#include <neo/container/mdspan.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace neo {
+
+/// Drives a processor with a fixed block size from callbacks of any size.
+///
+/// Incoming samples are swapped with the processed output of the previous
+/// block in a single internal buffer. Once the buffer is full, the processor
+/// runs in place on channels x block_size samples. Every sample is copied
+/// once in each direction and the added latency is exactly block_size().
+///
+/// \ingroup neo-container
+template<typename T>
+struct block_adapter
+{
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    block_adapter(size_type num_channels, size_type block_size);
+
+    [[nodiscard]] auto num_channels() const noexcept -> size_type { return _buffer.extent(0); }
+
+    [[nodiscard]] auto block_size() const noexcept -> size_type { return _buffer.extent(1); }
+
+    [[nodiscard]] auto latency() const noexcept -> size_type { return block_size(); }
+
+    auto reset() -> void;
+
+    /// Calls process(block) with a channels x block_size inout_matrix for every completed block
+    template<inout_matrix InOutMat, typename Processor>
+        requires std::invocable<Processor&, stdex::mdspan<T, stdex::dextents<size_type, 2>>>
+    auto operator()(InOutMat io, Processor&& process) -> void;
+
+private:
+    stdex::mdarray<T, stdex::dextents<size_type, 2>> _buffer;
+    size_type _position{0};
+};
+
+template<typename T>
+block_adapter<T>::block_adapter(size_type num_channels, size_type block_size) : _buffer{num_channels, block_size}
+{
+    assert(block_size > 0);
+    reset();
+}
+
+template<typename T>
+auto block_adapter<T>::reset() -> void
+{
+    fill(_buffer.to_mdspan(), T{});
+    _position = 0;
+}
+
+template<typename T>
+template<inout_matrix InOutMat, typename Processor>
+    requires std::invocable<Processor&, stdex::mdspan<T, stdex::dextents<std::size_t, 2>>>
+auto block_adapter<T>::operator()(InOutMat io, Processor&& process) -> void
+{
+    assert(io.extent(0) == num_channels());
+
+    auto const buffer = _buffer.to_mdspan();
+
+    for (auto offset{0zu}; offset < io.extent(1);) {
+        auto const count = std::min(block_size() - _position, io.extent(1) - offset);
+        for (auto ch{0zu}; ch < num_channels(); ++ch) {
+            for (auto i{0zu}; i < count; ++i) {
+                std::swap(io(ch, offset + i), buffer(ch, _position + i));
+            }
+        }
+
+        offset += count;
+        _position += count;
+
+        if (_position == block_size()) {
+            process(buffer);
+            _position = 0;
+        }
+    }
+}
+
+}  // namespace neo
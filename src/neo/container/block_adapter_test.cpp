@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT
+
+#include "block_adapter.hpp"
+
+#include <neo/convolution/dense_convolver.hpp>
+#include <neo/convolution/uniform_partition.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <random>
+
+TEMPLATE_TEST_CASE("neo/container: block_adapter", "", float, double)
+{
+    using Float = TestType;
+
+    auto const num_channels = GENERATE(as<std::size_t>{}, 1, 2, 3);
+    auto const block_size   = GENERATE(as<std::size_t>{}, 1, 16, 100);
+    CAPTURE(num_channels);
+    CAPTURE(block_size);
+
+    auto adapter = neo::block_adapter<Float>{num_channels, block_size};
+    REQUIRE(adapter.num_channels() == num_channels);
+    REQUIRE(adapter.block_size() == block_size);
+    REQUIRE(adapter.latency() == block_size);
+
+    auto const num_samples = 2000zu;
+    auto signal            = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_channels, num_samples};
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        for (auto i{0zu}; i < num_samples; ++i) {
+            signal(ch, i) = static_cast<Float>(ch * num_samples + i + 1zu);
+        }
+    }
+
+    // Processes a gain of 2, callback sizes are random
+    auto output    = signal;
+    auto num_calls = 0zu;
+    auto rng       = std::mt19937{Catch::getSeed()};
+    auto dist      = std::uniform_int_distribution<std::size_t>{0, 3 * block_size};
+    for (auto offset{0zu}; offset < num_samples;) {
+        auto const size = std::min(dist(rng), num_samples - offset);
+        auto const io   = stdex::submdspan(output.to_mdspan(), stdex::full_extent, std::tuple{offset, offset + size});
+        adapter(io, [&num_calls, block_size](auto block) {
+            REQUIRE(block.extent(1) == block_size);
+            for (auto ch{0zu}; ch < block.extent(0); ++ch) {
+                for (auto i{0zu}; i < block.extent(1); ++i) {
+                    block(ch, i) *= Float(2);
+                }
+            }
+            ++num_calls;
+        });
+        offset += size;
+    }
+
+    REQUIRE(num_calls == num_samples / block_size);
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        for (auto i{0zu}; i < num_samples; ++i) {
+            auto const expected = i < block_size ? Float(0) : signal(ch, i - block_size) * Float(2);
+            REQUIRE(output(ch, i) == expected);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/container: block_adapter(convolver)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const block_size = 128zu;
+    auto const impulse    = neo::generate_noise_signal<Float>(block_size * 4zu, Catch::getSeed());
+    auto const matrix     = stdex::mdspan{impulse.data(), stdex::extents{1zu, impulse.extent(0)}};
+    auto const filter     = neo::convolution::uniform_partition(matrix, block_size);
+    auto const channel    = stdex::submdspan(filter.to_mdspan(), 0, stdex::full_extent, stdex::full_extent);
+
+    auto reference = neo::convolution::upols_convolver<std::complex<Float>>{};
+    auto adapted   = neo::convolution::upols_convolver<std::complex<Float>>{};
+    reference.filter(channel);
+    adapted.filter(channel);
+
+    auto const signal = neo::generate_noise_signal<Float>(block_size * 16zu, Catch::getSeed() + 1U);
+    auto expected     = signal;
+    auto actual       = signal;
+
+    for (auto i{0zu}; i < signal.extent(0); i += block_size) {
+        reference(stdex::submdspan(expected.to_mdspan(), std::tuple{i, i + block_size}));
+    }
+
+    auto adapter = neo::block_adapter<Float>{1, block_size};
+    auto process = [&adapted](auto block) { adapted(stdex::submdspan(block, 0, stdex::full_extent)); };
+    for (auto i{0zu}; i < signal.extent(0); i += 37zu) {
+        auto const end = std::min(i + 37zu, signal.extent(0));
+        auto const io  = stdex::mdspan{actual.data() + i, stdex::extents{1zu, end - i}};
+        adapter(io, process);
+    }
+
+    for (auto i{block_size}; i < signal.extent(0); ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(actual(i), Catch::Matchers::WithinAbs(expected(i - block_size), 0.00001));
+    }
+}
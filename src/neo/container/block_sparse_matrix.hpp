@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/container/mdspan.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace neo {
+
+/// Sparse matrix storing each row as runs of contiguous non-zero columns.
+///
+/// Values of a run are stored back to back, so a row can be processed with dense
+/// (vectorized) kernels per run instead of a gather/scatter per element.
+///
+/// \ingroup neo-container
+template<
+    typename T,
+    typename IndexType      = std::size_t,
+    typename ValueContainer = std::vector<T>,
+    typename IndexContainer = std::vector<IndexType>>
+struct block_sparse_matrix
+{
+    using value_type           = T;
+    using size_type            = std::size_t;
+    using index_type           = IndexType;
+    using value_container_type = ValueContainer;
+    using index_container_type = IndexContainer;
+
+    block_sparse_matrix() = default;
+    block_sparse_matrix(size_type rows, size_type cols);
+
+    template<in_matrix InMat, std::predicate<IndexType, IndexType, T> Filter>
+        requires std::is_convertible_v<typename InMat::value_type, T>
+    block_sparse_matrix(InMat matrix, Filter filter);
+
+    [[nodiscard]] auto extent(size_type e) const noexcept -> size_type;
+    [[nodiscard]] auto extents() const noexcept -> stdex::dextents<index_type, 2>;
+
+    [[nodiscard]] auto rows() const noexcept -> size_type;
+    [[nodiscard]] auto columns() const noexcept -> size_type;
+    [[nodiscard]] auto size() const noexcept -> size_type;
+    [[nodiscard]] auto num_runs() const noexcept -> size_type;
+
+    [[nodiscard]] auto operator()(index_type row, index_type col) const -> T;
+
+    /// Values of a row's run r, with r in [row_container()[row], row_container()[row + 1])
+    [[nodiscard]] auto run(index_type r) const noexcept -> stdex::mdspan<T const, stdex::dextents<size_type, 1>>;
+
+    [[nodiscard]] auto value_container() const noexcept -> value_container_type const&;
+    [[nodiscard]] auto column_container() const noexcept -> index_container_type const&;
+    [[nodiscard]] auto offset_container() const noexcept -> index_container_type const&;
+    [[nodiscard]] auto row_container() const noexcept -> index_container_type const&;
+
+private:
+    stdex::dextents<index_type, 2> _extents;
+    ValueContainer _values;
+    IndexContainer _run_columns;
+    IndexContainer _run_offsets{IndexType(0)};
+    IndexContainer _row_indices;
+};
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::block_sparse_matrix(size_type rows, size_type cols)
+    : _extents{rows, cols}
+    , _row_indices(rows + 1zu, 0)
+{}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+template<in_matrix InMat, std::predicate<IndexType, IndexType, T> Filter>
+    requires std::is_convertible_v<typename InMat::value_type, T>
+block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::block_sparse_matrix(InMat matrix, Filter filter)
+    : block_sparse_matrix{matrix.extent(0), matrix.extent(1)}
+{
+    for (auto row_idx{0zu}; row_idx < matrix.extent(0); ++row_idx) {
+        auto const row        = stdex::submdspan(matrix, row_idx, stdex::full_extent);
+        _row_indices[row_idx] = _run_columns.size();
+
+        auto in_run = false;
+        for (auto col{0zu}; col < matrix.extent(1); ++col) {
+            auto const& val = row(col);
+            if (not filter(row_idx, col, val)) {
+                in_run = false;
+                continue;
+            }
+
+            if (not in_run) {
+                if (not _run_columns.empty()) {
+                    _run_offsets.push_back(_values.size());
+                }
+                _run_columns.push_back(col);
+                in_run = true;
+            }
+            _values.push_back(val);
+        }
+    }
+
+    if (not _run_columns.empty()) {
+        _run_offsets.push_back(_values.size());
+    }
+    _row_indices.back() = _run_columns.size();
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::extent(size_type e) const noexcept -> size_type
+{
+    return _extents.extent(e);
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::extents() const noexcept
+    -> stdex::dextents<index_type, 2>
+{
+    return _extents;
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::rows() const noexcept -> size_type
+{
+    return extent(0);
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::columns() const noexcept -> size_type
+{
+    return extent(1);
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::size() const noexcept -> size_type
+{
+    return columns() * rows();
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::num_runs() const noexcept -> size_type
+{
+    return _run_columns.size();
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::operator()(index_type row, index_type col) const
+    -> T
+{
+    for (auto r = _row_indices[row]; r < _row_indices[row + 1]; ++r) {
+        auto const first = _run_columns[r];
+        auto const last  = first + (_run_offsets[r + 1] - _run_offsets[r]);
+        if (col >= first and col < last) {
+            return _values[_run_offsets[r] + (col - first)];
+        }
+    }
+    return T{};
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::run(index_type r) const noexcept
+    -> stdex::mdspan<T const, stdex::dextents<size_type, 1>>
+{
+    auto const offset = static_cast<std::ptrdiff_t>(_run_offsets[r]);
+    auto const length = static_cast<size_type>(_run_offsets[r + 1] - _run_offsets[r]);
+    return stdex::mdspan<T const, stdex::dextents<size_type, 1>>{std::next(_values.data(), offset), length};
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::value_container() const noexcept
+    -> value_container_type const&
+{
+    return _values;
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::column_container() const noexcept
+    -> index_container_type const&
+{
+    return _run_columns;
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::offset_container() const noexcept
+    -> index_container_type const&
+{
+    return _run_offsets;
+}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+auto block_sparse_matrix<T, IndexType, ValueContainer, IndexContainer>::row_container() const noexcept
+    -> index_container_type const&
+{
+    return _row_indices;
+}
+
+}  // namespace neo
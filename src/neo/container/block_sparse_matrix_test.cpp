@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MIT
+
+#include "block_sparse_matrix.hpp"
+
+#include <neo/algorithm/fill.hpp>
+#include <neo/container/csr_matrix.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE("neo/container: block_sparse_matrix", "", float, double, std::complex<float>, std::complex<double>)
+{
+    using Scalar = TestType;
+    using Float  = neo::real_or_complex_value_t<Scalar>;
+
+    auto dense = stdex::mdarray<Scalar, stdex::dextents<std::size_t, 2>>{4, 32};
+    for (auto row{0zu}; row < dense.extent(0); ++row) {
+        for (auto col{0zu}; col < dense.extent(1); ++col) {
+            dense(row, col) = Scalar(static_cast<Float>(row * dense.extent(1) + col + 1zu));
+        }
+    }
+
+    SECTION("empty")
+    {
+        auto sparse = neo::block_sparse_matrix<Scalar>{4, 32};
+        REQUIRE(sparse.rows() == 4);
+        REQUIRE(sparse.columns() == 32);
+        REQUIRE(sparse.size() == 4 * 32);
+        REQUIRE(sparse.num_runs() == 0);
+        REQUIRE(sparse.value_container().empty());
+        REQUIRE(sparse(0, 0) == Scalar(0));
+    }
+
+    SECTION("all")
+    {
+        auto sparse = neo::block_sparse_matrix<Scalar>{dense.to_mdspan(), [](auto, auto, auto) { return true; }};
+        REQUIRE(sparse.rows() == dense.extent(0));
+        REQUIRE(sparse.columns() == dense.extent(1));
+        REQUIRE(sparse.extents() == dense.extents());
+        REQUIRE(sparse.num_runs() == dense.extent(0));
+        REQUIRE(sparse.value_container().size() == dense.size());
+
+        for (auto row{0zu}; row < dense.extent(0); ++row) {
+            REQUIRE(sparse.run(row).extent(0) == dense.extent(1));
+            for (auto col{0zu}; col < dense.extent(1); ++col) {
+                REQUIRE(sparse(row, col) == dense(row, col));
+            }
+        }
+    }
+
+    SECTION("runs")
+    {
+        // Keep [2, 6) and [10, 11) in every row, plus [28, 32) in odd rows
+        auto const keep = [](auto row, auto col, auto) {
+            return (col >= 2 and col < 6) or col == 10 or (row % 2 == 1 and col >= 28);
+        };
+
+        auto sparse = neo::block_sparse_matrix<Scalar>{dense.to_mdspan(), keep};
+        auto csr    = neo::csr_matrix<Scalar>{dense.to_mdspan(), keep};
+        REQUIRE(sparse.num_runs() == 10);
+        REQUIRE(sparse.value_container().size() == csr.value_container().size());
+
+        auto const& rows = sparse.row_container();
+        REQUIRE(rows[0] == 0);
+        REQUIRE(rows[1] == 2);
+        REQUIRE(rows[2] == 5);
+        REQUIRE(rows[4] == 10);
+
+        REQUIRE(sparse.column_container()[0] == 2);
+        REQUIRE(sparse.column_container()[1] == 10);
+        REQUIRE(sparse.column_container()[4] == 28);
+        REQUIRE(sparse.run(0).extent(0) == 4);
+        REQUIRE(sparse.run(1).extent(0) == 1);
+        REQUIRE(sparse.run(4).extent(0) == 4);
+        REQUIRE(sparse.run(4)[0] == dense(1, 28));
+
+        for (auto row{0zu}; row < dense.extent(0); ++row) {
+            for (auto col{0zu}; col < dense.extent(1); ++col) {
+                REQUIRE(sparse(row, col) == csr(row, col));
+            }
+        }
+    }
+}
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/container/mdspan.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+
+namespace neo {
+
+/// Lock-free single-producer single-consumer ring buffer.
+///
+/// One thread may push while another pops, without locks or allocation.
+/// The capacity is rounded up to a power of two.
+///
+/// \ingroup neo-container
+template<typename T>
+struct spsc_ring_buffer
+{
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    explicit spsc_ring_buffer(size_type capacity);
+
+    [[nodiscard]] auto capacity() const noexcept -> size_type { return _mask + 1zu; }
+
+    /// Number of values the consumer can pop, only exact when called from the consumer thread
+    [[nodiscard]] auto read_available() const noexcept -> size_type;
+
+    /// Number of values the producer can push, only exact when called from the producer thread
+    [[nodiscard]] auto write_available() const noexcept -> size_type;
+
+    [[nodiscard]] auto try_push(T const& value) noexcept -> bool;
+    [[nodiscard]] auto try_pop(T& value) noexcept -> bool;
+
+    /// Pushes as many values as fit, returns the number of values pushed
+    auto push(in_vector auto values) noexcept -> size_type;
+
+    /// Pops up to values.extent(0) values, returns the number of values popped
+    auto pop(out_vector auto values) noexcept -> size_type;
+
+private:
+    // Head & tail on separate cache lines, so producer and consumer don't false share
+    alignas(64) std::atomic<size_type> _write{0};
+    alignas(64) std::atomic<size_type> _read{0};
+    alignas(64) size_type _mask;
+    std::unique_ptr<T[]> _buffer;
+};
+
+template<typename T>
+spsc_ring_buffer<T>::spsc_ring_buffer(size_type capacity)
+    : _mask{std::bit_ceil(std::max(capacity, 1zu)) - 1zu}
+    , _buffer{std::make_unique<T[]>(_mask + 1zu)}
+{}
+
+template<typename T>
+auto spsc_ring_buffer<T>::read_available() const noexcept -> size_type
+{
+    return _write.load(std::memory_order_acquire) - _read.load(std::memory_order_acquire);
+}
+
+template<typename T>
+auto spsc_ring_buffer<T>::write_available() const noexcept -> size_type
+{
+    return capacity() - read_available();
+}
+
+template<typename T>
+auto spsc_ring_buffer<T>::try_push(T const& value) noexcept -> bool
+{
+    auto const write = _write.load(std::memory_order_relaxed);
+    if (write - _read.load(std::memory_order_acquire) == capacity()) {
+        return false;
+    }
+
+    _buffer[write & _mask] = value;
+    _write.store(write + 1zu, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+auto spsc_ring_buffer<T>::try_pop(T& value) noexcept -> bool
+{
+    auto const read = _read.load(std::memory_order_relaxed);
+    if (_write.load(std::memory_order_acquire) == read) {
+        return false;
+    }
+
+    value = _buffer[read & _mask];
+    _read.store(read + 1zu, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+auto spsc_ring_buffer<T>::push(in_vector auto values) noexcept -> size_type
+{
+    auto const write = _write.load(std::memory_order_relaxed);
+    auto const free  = capacity() - (write - _read.load(std::memory_order_acquire));
+    auto const count = std::min(free, static_cast<size_type>(values.extent(0)));
+
+    // At most two contiguous runs, before and after the wrap around
+    auto const start = write & _mask;
+    auto const first = std::min(count, capacity() - start);
+    for (auto i{0zu}; i < first; ++i) {
+        _buffer[start + i] = values[i];
+    }
+    for (auto i{first}; i < count; ++i) {
+        _buffer[i - first] = values[i];
+    }
+
+    _write.store(write + count, std::memory_order_release);
+    return count;
+}
+
+template<typename T>
+auto spsc_ring_buffer<T>::pop(out_vector auto values) noexcept -> size_type
+{
+    auto const read  = _read.load(std::memory_order_relaxed);
+    auto const used  = _write.load(std::memory_order_acquire) - read;
+    auto const count = std::min(used, static_cast<size_type>(values.extent(0)));
+
+    auto const start = read & _mask;
+    auto const first = std::min(count, capacity() - start);
+    for (auto i{0zu}; i < first; ++i) {
+        values[i] = _buffer[start + i];
+    }
+    for (auto i{first}; i < count; ++i) {
+        values[i] = _buffer[i - first];
+    }
+
+    _read.store(read + count, std::memory_order_release);
+    return count;
+}
+
+}  // namespace neo
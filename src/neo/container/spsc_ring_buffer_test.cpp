@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+
+#include "spsc_ring_buffer.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <thread>
+#include <vector>
+
+TEMPLATE_TEST_CASE("neo/container: spsc_ring_buffer", "", int, float, double)
+{
+    using T = TestType;
+
+    auto buffer = neo::spsc_ring_buffer<T>{5};
+    REQUIRE(buffer.capacity() == 8);
+    REQUIRE(buffer.read_available() == 0);
+    REQUIRE(buffer.write_available() == 8);
+
+    auto value = T{};
+    REQUIRE_FALSE(buffer.try_pop(value));
+
+    for (auto i{0}; i < 8; ++i) {
+        REQUIRE(buffer.try_push(T(i)));
+    }
+    REQUIRE_FALSE(buffer.try_push(T(8)));
+    REQUIRE(buffer.read_available() == 8);
+    REQUIRE(buffer.write_available() == 0);
+
+    REQUIRE(buffer.try_pop(value));
+    REQUIRE(value == T(0));
+
+    // Bulk push & pop across the wrap around
+    auto in = std::vector<T>{T(10), T(11), T(12)};
+    REQUIRE(buffer.push(stdex::mdspan{in.data(), stdex::extents{in.size()}}) == 1);
+
+    auto out = std::vector<T>(16);
+    REQUIRE(buffer.pop(stdex::mdspan{out.data(), stdex::extents{3zu}}) == 3);
+    REQUIRE(out[0] == T(1));
+    REQUIRE(out[1] == T(2));
+    REQUIRE(out[2] == T(3));
+
+    REQUIRE(buffer.push(stdex::mdspan{in.data(), stdex::extents{in.size()}}) == 3);
+    REQUIRE(buffer.read_available() == 8);
+    REQUIRE(buffer.pop(stdex::mdspan{out.data(), stdex::extents{out.size()}}) == 8);
+
+    auto const expected = std::vector<T>{T(4), T(5), T(6), T(7), T(10), T(10), T(11), T(12)};
+    for (auto i{0zu}; i < expected.size(); ++i) {
+        CAPTURE(i);
+        REQUIRE(out[i] == expected[i]);
+    }
+    REQUIRE(buffer.read_available() == 0);
+}
+
+TEST_CASE("neo/container: spsc_ring_buffer(threads)")
+{
+    auto const capacity = GENERATE(as<std::size_t>{}, 1, 7, 256);
+    CAPTURE(capacity);
+
+    static constexpr auto num_values = 100'000;
+
+    auto buffer   = neo::spsc_ring_buffer<int>{capacity};
+    auto producer = std::jthread{[&buffer] {
+        auto chunk = std::vector<int>(13);
+        for (auto next{0}; next < num_values;) {
+            auto const size = std::min(chunk.size(), static_cast<std::size_t>(num_values - next));
+            for (auto i{0zu}; i < size; ++i) {
+                chunk[i] = next + static_cast<int>(i);
+            }
+            auto const pushed = buffer.push(stdex::mdspan{chunk.data(), stdex::extents{size}});
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            next += static_cast<int>(pushed);
+        }
+    }};
+
+    auto errors = 0;
+    auto chunk  = std::vector<int>(5);
+    for (auto expected{0}; expected < num_values;) {
+        auto const count = buffer.pop(stdex::mdspan{chunk.data(), stdex::extents{chunk.size()}});
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+        for (auto i{0zu}; i < count; ++i) {
+            errors += static_cast<int>(chunk[i] != expected++);
+        }
+    }
+
+    REQUIRE(errors == 0);
+}
@@ -8,18 +8,31 @@
 /// Convolution functions
 
 #include <neo/convolution/compressed_fdl.hpp>
+#include <neo/convolution/convolve.hpp>
 #include <neo/convolution/dense_convolver.hpp>
 #include <neo/convolution/dense_fdl.hpp>
 #include <neo/convolution/dense_filter.hpp>
 #include <neo/convolution/direct_convolve.hpp>
+#include <neo/convolution/direct_fir.hpp>
 #include <neo/convolution/fdl_index.hpp>
 #include <neo/convolution/fft_convolver.hpp>
 #include <neo/convolution/method.hpp>
+#include <neo/convolution/mixed_precision_filter.hpp>
 #include <neo/convolution/mode.hpp>
+#include <neo/convolution/multichannel_convolver.hpp>
 #include <neo/convolution/normalize_impulse.hpp>
+#include <neo/convolution/offline_convolver.hpp>
 #include <neo/convolution/overlap_add.hpp>
 #include <neo/convolution/overlap_save.hpp>
+#include <neo/convolution/polyphase_resampler.hpp>
+#include <neo/convolution/quantized_convolver.hpp>
+#include <neo/convolution/quantized_fdl.hpp>
+#include <neo/convolution/quantized_filter.hpp>
+#include <neo/convolution/quantized_span.hpp>
 #include <neo/convolution/sparse_convolver.hpp>
+#include <neo/convolution/sparse_fdl.hpp>
 #include <neo/convolution/sparse_filter.hpp>
+#include <neo/convolution/sparsity.hpp>
 #include <neo/convolution/uniform_partition.hpp>
 #include <neo/convolution/uniform_partitioned_convolver.hpp>
+#include <neo/convolution/zero_latency_convolver.hpp>
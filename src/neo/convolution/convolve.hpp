@@ -0,0 +1,391 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/algorithm/copy.hpp>
+#include <neo/algorithm/fill.hpp>
+#include <neo/algorithm/multiply.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/convolution/dense_convolver.hpp>
+#include <neo/convolution/direct_fir.hpp>
+#include <neo/convolution/fft_convolver.hpp>
+#include <neo/convolution/method.hpp>
+#include <neo/convolution/mode.hpp>
+#include <neo/convolution/overlap_add.hpp>
+#include <neo/convolution/overlap_save.hpp>
+#include <neo/convolution/uniform_partition.hpp>
+#include <neo/fft/order.hpp>
+#include <neo/fft/rfft.hpp>
+#include <neo/math/idiv.hpp>
+#include <neo/simd/native.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+
+namespace neo::convolution {
+
+/// Relative costs of the building blocks of all convolution methods.
+///
+/// The defaults are derived from the precision and the native SIMD width.
+/// calibrate_cost_model() replaces them with measurements on the current machine.
+///
+/// \ingroup neo-convolution
+struct cost_model
+{
+    /// Time of one multiply-accumulate of direct_fir
+    double direct_mac{1.0};
+
+    /// Time per N * log2(N) of one real fft of size N
+    double fft_butterfly{1.0};
+
+    /// Time of one complex multiply(-accumulate) of two spectra
+    double spectrum_mac{1.0};
+
+    /// Fixed time for each processed block of a streaming method
+    double block_overhead{0.0};
+};
+
+/// Method and block size chosen by select_method()
+/// \ingroup neo-convolution
+struct convolution_strategy
+{
+    convolution::method method{method::direct};
+    std::size_t block_size{0};
+    double cost{0.0};
+};
+
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+[[nodiscard]] auto default_cost_model() noexcept -> cost_model
+{
+#if defined(NEO_HAS_ISA_SSE2)
+    auto const lanes = static_cast<double>(std::same_as<Float, float> ? float32x::size : float64x::size);
+#elif defined(NEO_HAS_ISA_NEON)
+    auto const lanes = std::same_as<Float, float> ? 4.0 : 2.0;
+#else
+    auto const lanes = 1.0;
+#endif
+
+    // Relative to one scalar multiply-accumulate. The fft & spectrum kernels gain less from wider registers.
+    return {
+        .direct_mac     = 1.0 / lanes,
+        .fft_butterfly  = 2.0 / std::sqrt(lanes),
+        .spectrum_mac   = 4.0 / std::sqrt(lanes),
+        .block_overhead = 200.0,
+    };
+}
+
+/// Estimated cost of convolving \p signal_size with \p patch_size samples
+/// \details \p block_size is ignored for method::direct & method::fft.
+/// \ingroup neo-convolution
+[[nodiscard]] inline auto estimate_cost(
+    method m,
+    std::size_t signal_size,
+    std::size_t patch_size,
+    std::size_t block_size,
+    cost_model const& model
+) -> double
+{
+    auto const transform = [&model](std::size_t size) {
+        auto const n = static_cast<double>(size);
+        return model.fft_butterfly * n * std::log2(std::max(n, 2.0));
+    };
+
+    auto const output = static_cast<double>(output_size<mode::full>(signal_size, patch_size));
+    auto const blocks = [&] { return std::ceil(output / static_cast<double>(block_size)); };
+
+    switch (m) {
+        case method::automatic: break;
+        case method::direct: {
+            return model.direct_mac * static_cast<double>(signal_size) * static_cast<double>(patch_size);
+        }
+        case method::fft: {
+            auto const size = std::size_t(1) << fft::next_order(static_cast<std::size_t>(output));
+            return transform(size) * 3.0 + model.spectrum_mac * static_cast<double>(size / 2 + 1);
+        }
+        case method::ola:
+        case method::ols: {
+            auto const size  = std::size_t(1) << fft::next_order(block_size + patch_size - 1zu);
+            auto const bins  = static_cast<double>(size / 2 + 1);
+            auto const block = transform(size) * 2.0 + model.spectrum_mac * bins + model.block_overhead;
+            return transform(size) + blocks() * block;
+        }
+        case method::upola:
+        case method::upols: {
+            auto const partitions = static_cast<double>(idiv(patch_size, block_size));
+            auto const bins       = static_cast<double>(block_size + 1);
+            auto const block      = transform(block_size * 2zu) * 2.0 + model.spectrum_mac * bins * partitions;
+            return transform(block_size * 2zu) * partitions + blocks() * (block + model.block_overhead);
+        }
+    }
+
+    return std::numeric_limits<double>::infinity();
+}
+
+/// Picks the cheapest method (and block size) according to the cost model
+/// \details Only considers the overlap-save variants, overlap-add has the same cost but needs an extra pass.
+/// \ingroup neo-convolution
+[[nodiscard]] inline auto
+select_method(std::size_t signal_size, std::size_t patch_size, cost_model const& model) -> convolution_strategy
+{
+    assert(signal_size > 0);
+    assert(patch_size > 0);
+
+    auto const direct = estimate_cost(method::direct, signal_size, patch_size, 0, model);
+
+    auto best     = convolution_strategy{method::direct, 0, direct};
+    auto consider = [&](method m, std::size_t block_size) {
+        auto const cost = estimate_cost(m, signal_size, patch_size, block_size, model);
+        if (cost < best.cost) {
+            best = {m, block_size, cost};
+        }
+    };
+
+    consider(method::fft, 0);
+
+    // One-shot partition: transform sizes of at least twice the filter, block fills the remaining space
+    auto const output = output_size<mode::full>(signal_size, patch_size);
+    auto const first  = std::size_t(1) << fft::next_order(patch_size * 2zu);
+    for (auto size = first; size <= first * 16zu and size - patch_size + 1zu < output; size *= 2zu) {
+        consider(method::ols, size - patch_size + 1zu);
+    }
+
+    // Uniform partitions from 64 up to the filter length
+    for (auto block = 64zu; block < patch_size and block < output; block *= 2zu) {
+        consider(method::upols, block);
+    }
+
+    return best;
+}
+
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+[[nodiscard]] auto select_method(std::size_t signal_size, std::size_t patch_size) -> convolution_strategy
+{
+    return select_method(signal_size, patch_size, default_cost_model<Float>());
+}
+
+namespace detail {
+
+/// Streams the (zero-padded) output in place through a block based processor
+template<std::floating_point Float>
+auto process_blocks(inout_vector auto output, std::size_t block_size, auto process) -> void
+{
+    auto buffer = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{block_size};
+    auto block  = buffer.to_mdspan();
+
+    for (auto offset{0zu}; offset < output.extent(0); offset += block_size) {
+        auto const size = std::min(block_size, output.extent(0) - offset);
+        auto const io   = stdex::submdspan(output, std::tuple{offset, offset + size});
+
+        copy(io, stdex::submdspan(block, std::tuple{0zu, size}));
+        fill(stdex::submdspan(block, std::tuple{size, block_size}), Float(0));
+        process(block);
+        copy(stdex::submdspan(block, std::tuple{0zu, size}), io);
+    }
+}
+
+template<typename Overlap, std::floating_point Float>
+auto overlap_convolve(
+    in_vector auto patch,
+    inout_vector auto output,
+    std::size_t block_size,
+    std::size_t filter_size
+) -> void
+{
+    assert(filter_size >= patch.extent(0));
+    auto overlap = Overlap{block_size, filter_size};
+
+    auto plan   = fft::rfft_plan<Float>{fft::from_order, fft::next_order(overlap.transform_size())};
+    auto padded = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{plan.size()};
+    auto filter = stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 1>>{plan.size() / 2zu + 1zu};
+    copy(patch, stdex::submdspan(padded.to_mdspan(), std::tuple{0zu, patch.extent(0)}));
+    rfft(plan, padded.to_mdspan(), filter.to_mdspan());
+
+    process_blocks<Float>(output, block_size, [&](inout_vector auto block) {
+        overlap(block, [&filter](inout_vector auto spectrum) { multiply(spectrum, filter.to_mdspan(), spectrum); });
+    });
+}
+
+template<typename Convolver, std::floating_point Float>
+auto partitioned_convolve(in_vector auto patch, inout_vector auto output, std::size_t block_size) -> void
+{
+    auto impulse = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{1zu, patch.extent(0)};
+    copy(patch, stdex::submdspan(impulse.to_mdspan(), 0, stdex::full_extent));
+
+    auto const partitions = uniform_partition(impulse.to_mdspan(), block_size);
+    auto convolver        = Convolver{};
+    convolver.filter(stdex::submdspan(partitions.to_mdspan(), 0, stdex::full_extent, stdex::full_extent));
+
+    process_blocks<Float>(output, block_size, [&convolver](inout_vector auto block) { convolver(block); });
+}
+
+}  // namespace detail
+
+/// Full linear convolution with the given (or automatically selected) method
+/// \ingroup neo-convolution
+template<in_vector Signal, in_vector Patch, inout_vector Output>
+    requires(std::floating_point<value_type_t<Signal>> and std::same_as<value_type_t<Signal>, value_type_t<Patch>>)
+auto convolve(
+    Signal signal,
+    Patch patch,
+    Output output,
+    method m                = method::automatic,
+    cost_model const& model = default_cost_model<value_type_t<Signal>>()
+) -> void
+{
+    using Float = value_type_t<Signal>;
+
+    auto const signal_size = signal.extent(0);
+    auto const patch_size  = patch.extent(0);
+    assert(std::cmp_equal(output.extent(0), output_size<mode::full>(signal_size, patch_size)));
+
+    auto strategy = convolution_strategy{m, 0};
+    if (m == method::automatic) {
+        strategy = select_method(signal_size, patch_size, model);
+    } else if (m == method::ola) {
+        // overlap_add needs a power of two block, that is at least as long as the filter
+        strategy.block_size = std::size_t(1) << fft::next_order(std::max(patch_size, 16zu));
+    } else if (m == method::ols) {
+        strategy.block_size = (std::size_t(1) << fft::next_order(std::max(patch_size * 2zu, 32zu))) - patch_size + 1zu;
+    } else if (m == method::upola or m == method::upols) {
+        strategy.block_size = std::max((std::size_t(1) << fft::next_order(patch_size)) / 8zu, 64zu);
+    }
+
+    if (strategy.method == method::fft) {
+        auto convolver = fft_convolver<Float>{signal_size, patch_size};
+        convolver(signal, patch, output);
+        return;
+    }
+
+    // All other methods stream the zero-padded signal through the output buffer
+    copy(signal, stdex::submdspan(output, std::tuple{0zu, signal_size}));
+    fill(stdex::submdspan(output, std::tuple{signal_size, output.extent(0)}), Float(0));
+
+    switch (strategy.method) {
+        case method::direct: {
+            auto fir = direct_fir<Float>{};
+            fir.filter(patch);
+            fir(output);
+            break;
+        }
+        case method::ola: {
+            // overlap_add expects a transform of twice the block size
+            auto const block = strategy.block_size;
+            detail::overlap_convolve<overlap_add<std::complex<Float>>, Float>(patch, output, block, block);
+            break;
+        }
+        case method::ols: {
+            auto const block = strategy.block_size;
+            detail::overlap_convolve<overlap_save<std::complex<Float>>, Float>(patch, output, block, patch_size);
+            break;
+        }
+        case method::upola: {
+            using Convolver = upola_convolver<std::complex<Float>>;
+            detail::partitioned_convolve<Convolver, Float>(patch, output, strategy.block_size);
+            break;
+        }
+        case method::upols: {
+            using Convolver = upols_convolver<std::complex<Float>>;
+            detail::partitioned_convolve<Convolver, Float>(patch, output, strategy.block_size);
+            break;
+        }
+        default: throw std::invalid_argument{"unsupported convolution method"};
+    }
+}
+
+/// \ingroup neo-convolution
+template<in_vector Signal, in_vector Patch>
+    requires(std::floating_point<value_type_t<Signal>> and std::same_as<value_type_t<Signal>, value_type_t<Patch>>)
+[[nodiscard]] auto convolve(
+    Signal signal,
+    Patch patch,
+    method m                = method::automatic,
+    cost_model const& model = default_cost_model<value_type_t<Signal>>()
+)
+{
+    using Float = value_type_t<Signal>;
+
+    if (signal.extent(0) == 0 or patch.extent(0) == 0) {
+        return stdex::mdarray<Float, stdex::dextents<size_t, 1>>{};
+    }
+
+    auto output = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{
+        output_size<mode::full>(signal.extent(0), patch.extent(0)),
+    };
+    convolve(signal, patch, output.to_mdspan(), m, model);
+    return output;
+}
+
+/// Measures the cost model with \p measure, which runs the callable it is passed &
+/// returns its duration. The costs are in the unit of the returned durations.
+/// \ingroup neo-convolution
+template<std::floating_point Float, typename Measure>
+[[nodiscard]] auto calibrate_cost_model(Measure measure) -> cost_model
+{
+    auto model = default_cost_model<Float>();
+
+    // Direct: 64 taps over 16384 samples
+    auto signal = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{16384zu};
+    auto taps   = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{64zu};
+    auto fir    = direct_fir<Float>{};
+    fill(taps.to_mdspan(), Float(0.5));
+    fir.filter(taps.to_mdspan());
+    model.direct_mac = measure([&] { fir(signal.to_mdspan()); }) / (16384.0 * 64.0);
+
+    // FFT: 16 forward & backward transforms of size 4096
+    auto plan     = fft::rfft_plan<Float>{fft::from_order, 12zu};
+    auto spectrum = stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 1>>{plan.size() / 2zu + 1zu};
+    auto buffer   = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{plan.size()};
+    auto const transforms = measure([&] {
+        for (auto i{0}; i < 16; ++i) {
+            rfft(plan, buffer.to_mdspan(), spectrum.to_mdspan());
+            irfft(plan, spectrum.to_mdspan(), buffer.to_mdspan());
+        }
+    });
+    model.fft_butterfly = transforms / (32.0 * 4096.0 * 12.0);
+
+    // Spectrum multiply
+    auto const bins = static_cast<double>(spectrum.extent(0));
+    model.spectrum_mac
+        = measure([&] {
+              for (auto i{0}; i < 16; ++i) {
+                  multiply(spectrum.to_mdspan(), spectrum.to_mdspan(), spectrum.to_mdspan());
+              }
+          })
+        / (16.0 * bins);
+
+    // Keep the per block overhead relative to the direct kernel
+    auto const defaults  = default_cost_model<Float>();
+    model.block_overhead = defaults.block_overhead * model.direct_mac / defaults.direct_mac;
+
+    return model;
+}
+
+/// Measures the cost model on the current machine, all costs are in nanoseconds
+/// \details Takes a few milliseconds. The result can be stored and reused for all later calls.
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+[[nodiscard]] auto calibrate_cost_model() -> cost_model
+{
+    using clock = std::chrono::steady_clock;
+
+    return calibrate_cost_model<Float>([](auto func) {
+        auto best = std::numeric_limits<double>::max();
+        for (auto run{0}; run < 5; ++run) {
+            auto const start = clock::now();
+            func();
+            best = std::min(best, std::chrono::duration<double, std::nano>(clock::now() - start).count());
+        }
+        return best;
+    });
+}
+
+}  // namespace neo::convolution
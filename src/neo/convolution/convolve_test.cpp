@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: MIT
+
+#include "convolve.hpp"
+
+#include <neo/convolution/direct_convolve.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <array>
+
+TEMPLATE_TEST_CASE("neo/convolution: convolve", "", float, double)
+{
+    using Float = TestType;
+
+    using neo::convolution::method;
+
+    auto const m           = GENERATE(method::automatic, method::direct, method::fft, method::ola, method::ols);
+    auto const signal_size = GENERATE(as<std::size_t>{}, 1, 17, 500, 2048);
+    auto const patch_size  = GENERATE(as<std::size_t>{}, 1, 16, 100, 1000);
+    CAPTURE(static_cast<int>(m));
+    CAPTURE(signal_size);
+    CAPTURE(patch_size);
+
+    auto const signal   = neo::generate_noise_signal<Float>(signal_size, Catch::getSeed());
+    auto const patch    = neo::generate_noise_signal<Float>(patch_size, Catch::getSeed() + 1U);
+    auto const expected = neo::convolution::direct_convolve(signal.to_mdspan(), patch.to_mdspan());
+    auto const output   = neo::convolution::convolve(signal.to_mdspan(), patch.to_mdspan(), m);
+    REQUIRE(output.extent(0) == expected.extent(0));
+
+    for (auto i{0zu}; i < output.extent(0); ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(output(i), Catch::Matchers::WithinAbs(expected(i), 0.001));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: convolve(partitioned)", "", float, double)
+{
+    using Float = TestType;
+
+    using neo::convolution::method;
+
+    auto const m           = GENERATE(method::upola, method::upols);
+    auto const signal_size = GENERATE(as<std::size_t>{}, 1, 500, 2048);
+    auto const patch_size  = GENERATE(as<std::size_t>{}, 1, 100, 1000);
+    CAPTURE(static_cast<int>(m));
+    CAPTURE(signal_size);
+    CAPTURE(patch_size);
+
+    auto const signal   = neo::generate_noise_signal<Float>(signal_size, Catch::getSeed());
+    auto const patch    = neo::generate_noise_signal<Float>(patch_size, Catch::getSeed() + 1U);
+    auto const expected = neo::convolution::direct_convolve(signal.to_mdspan(), patch.to_mdspan());
+    auto const output   = neo::convolution::convolve(signal.to_mdspan(), patch.to_mdspan(), m);
+    REQUIRE(output.extent(0) == expected.extent(0));
+
+    for (auto i{0zu}; i < output.extent(0); ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(output(i), Catch::Matchers::WithinAbs(expected(i), 0.001));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: select_method", "", float, double)
+{
+    using Float = TestType;
+
+    using neo::convolution::method;
+
+    auto const model = neo::convolution::default_cost_model<Float>();
+    REQUIRE(neo::convolution::select_method(1024, 16, model).method == method::direct);
+    REQUIRE(neo::convolution::select_method(16, 1024, model).method == method::direct);
+    REQUIRE(neo::convolution::select_method(8192, 8192, model).method != method::direct);
+
+    auto const huge = neo::convolution::select_method(1zu << 24zu, 1zu << 21zu, model);
+    REQUIRE(huge.method != method::direct);
+    REQUIRE(huge.method != method::automatic);
+    REQUIRE(huge.cost <= neo::convolution::estimate_cost(method::fft, 1zu << 24zu, 1zu << 21zu, 0, model));
+
+    auto const calibrated = neo::convolution::calibrate_cost_model<Float>();
+    REQUIRE(calibrated.direct_mac > 0.0);
+    REQUIRE(calibrated.fft_butterfly > 0.0);
+    REQUIRE(calibrated.spectrum_mac > 0.0);
+    REQUIRE(calibrated.block_overhead > 0.0);
+    REQUIRE(neo::convolution::select_method(1024, 4, calibrated).method != method::automatic);
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: calibrate_cost_model", "", float, double)
+{
+    using Float = TestType;
+
+    using neo::convolution::method;
+
+    // Direct, transform & spectrum runs in call order, each measured once
+    auto const durations = std::array{16384.0 * 64.0 * 0.25, 32.0 * 4096.0 * 12.0, 16.0 * 2049.0 * 2.0};
+    auto calls           = 0zu;
+    auto const model     = neo::convolution::calibrate_cost_model<Float>([&](auto func) {
+        func();
+        return durations[calls++];
+    });
+    REQUIRE(calls == durations.size());
+
+    auto const defaults = neo::convolution::default_cost_model<Float>();
+    REQUIRE_THAT(model.direct_mac, Catch::Matchers::WithinRel(0.25));
+    REQUIRE_THAT(model.fft_butterfly, Catch::Matchers::WithinRel(1.0));
+    REQUIRE_THAT(model.spectrum_mac, Catch::Matchers::WithinRel(2.0));
+    REQUIRE_THAT(
+        model.block_overhead,
+        Catch::Matchers::WithinRel(defaults.block_overhead * 0.25 / defaults.direct_mac)
+    );
+
+    REQUIRE(neo::convolution::select_method(1024, 4, model).method == method::direct);
+    REQUIRE(neo::convolution::select_method(1zu << 24zu, 1zu << 21zu, model).method != method::direct);
+}
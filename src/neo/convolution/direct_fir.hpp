@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/algorithm/fill.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/simd/native.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+
+namespace neo::convolution {
+
+namespace detail {
+
+/// out[n] = sum_j taps[j] * in[n + j], vectorized across output samples
+template<std::floating_point Float>
+auto direct_fir_correlate(
+    Float const* NEO_RESTRICT in,
+    Float const* NEO_RESTRICT taps,
+    std::size_t num_taps,
+    Float* NEO_RESTRICT out,
+    std::size_t size
+) noexcept -> void
+{
+    auto n = 0zu;
+
+#if defined(NEO_HAS_ISA_SSE2)
+    if constexpr (std::same_as<Float, float> or std::same_as<Float, double>) {
+        using Batch = std::conditional_t<std::same_as<Float, float>, float32x, float64x>;
+
+        static constexpr auto width = Batch::size;
+
+        // 4 independent accumulators hide the add latency, every tap is broadcast once per 4 registers
+        for (; n + width * 4zu <= size; n += width * 4zu) {
+            auto acc0 = Batch::broadcast(Float(0));
+            auto acc1 = Batch::broadcast(Float(0));
+            auto acc2 = Batch::broadcast(Float(0));
+            auto acc3 = Batch::broadcast(Float(0));
+
+            for (auto j{0zu}; j < num_taps; ++j) {
+                auto const tap = Batch::broadcast(taps[j]);
+                auto const* x  = in + n + j;
+                acc0           = acc0 + tap * Batch::load_unaligned(x);
+                acc1           = acc1 + tap * Batch::load_unaligned(x + width);
+                acc2           = acc2 + tap * Batch::load_unaligned(x + width * 2zu);
+                acc3           = acc3 + tap * Batch::load_unaligned(x + width * 3zu);
+            }
+
+            acc0.store_unaligned(out + n);
+            acc1.store_unaligned(out + n + width);
+            acc2.store_unaligned(out + n + width * 2zu);
+            acc3.store_unaligned(out + n + width * 3zu);
+        }
+
+        for (; n + width <= size; n += width) {
+            auto acc = Batch::broadcast(Float(0));
+            for (auto j{0zu}; j < num_taps; ++j) {
+                acc = acc + Batch::broadcast(taps[j]) * Batch::load_unaligned(in + n + j);
+            }
+            acc.store_unaligned(out + n);
+        }
+    }
+#endif
+
+    for (; n < size; ++n) {
+        auto acc = Float(0);
+        for (auto j{0zu}; j < num_taps; ++j) {
+            acc += taps[j] * in[n + j];
+        }
+        out[n] = acc;
+    }
+}
+
+}  // namespace detail
+
+/// Streaming time-domain FIR filter without latency.
+///
+/// Meant for short filters (up to a few hundred taps). Blocks of any size are
+/// processed in place, the input history is kept between calls.
+///
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+struct direct_fir
+{
+    using value_type = Float;
+
+    direct_fir() = default;
+
+    auto filter(in_vector_of<Float> auto taps) -> void;
+    auto reset() -> void;
+    auto operator()(inout_vector_of<Float> auto block) -> void;
+
+private:
+    static constexpr auto chunk_size = 256zu;
+
+    // Taps reversed, so the filter becomes a correlation over the buffer
+    stdex::mdarray<Float, stdex::dextents<size_t, 1>> _taps;
+
+    // History of num_taps - 1 samples, followed by the current chunk
+    stdex::mdarray<Float, stdex::dextents<size_t, 1>> _buffer;
+    stdex::mdarray<Float, stdex::dextents<size_t, 1>> _output{chunk_size};
+};
+
+template<std::floating_point Float>
+auto direct_fir<Float>::filter(in_vector_of<Float> auto taps) -> void
+{
+    auto const num_taps = taps.extent(0);
+
+    _taps   = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{num_taps};
+    _buffer = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{std::max(num_taps, 1zu) - 1zu + chunk_size};
+    for (auto i{0zu}; i < num_taps; ++i) {
+        _taps(i) = taps[num_taps - i - 1zu];
+    }
+}
+
+template<std::floating_point Float>
+auto direct_fir<Float>::reset() -> void
+{
+    fill(_buffer.to_mdspan(), Float(0));
+}
+
+template<std::floating_point Float>
+auto direct_fir<Float>::operator()(inout_vector_of<Float> auto block) -> void
+{
+    auto const num_taps = _taps.extent(0);
+    if (num_taps == 0) {
+        fill(block, Float(0));
+        return;
+    }
+
+    auto const history = num_taps - 1zu;
+    auto* const buffer = _buffer.data();
+
+    for (auto offset{0zu}; offset < block.extent(0); offset += chunk_size) {
+        auto const size = std::min(chunk_size, block.extent(0) - offset);
+        for (auto i{0zu}; i < size; ++i) {
+            buffer[history + i] = block[offset + i];
+        }
+
+        detail::direct_fir_correlate(buffer, _taps.data(), num_taps, _output.data(), size);
+        for (auto i{0zu}; i < size; ++i) {
+            block[offset + i] = _output(i);
+        }
+
+        std::copy(buffer + size, buffer + size + history, buffer);
+    }
+}
+
+}  // namespace neo::convolution
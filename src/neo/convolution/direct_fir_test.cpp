@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: MIT
+
+#include "direct_fir.hpp"
+
+#include <neo/convolution/direct_convolve.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+TEMPLATE_TEST_CASE("neo/convolution: direct_fir", "", float, double)
+{
+    using Float = TestType;
+
+    auto const num_taps   = GENERATE(as<std::size_t>{}, 1, 3, 16, 33, 128, 300);
+    auto const block_size = GENERATE(as<std::size_t>{}, 1, 7, 64, 257, 512);
+    CAPTURE(num_taps);
+    CAPTURE(block_size);
+
+    auto const taps     = neo::generate_noise_signal<Float>(num_taps, Catch::getSeed());
+    auto const signal   = neo::generate_noise_signal<Float>(2048, Catch::getSeed() + 1U);
+    auto const expected = neo::convolution::direct_convolve(signal.to_mdspan(), taps.to_mdspan());
+
+    auto fir = neo::convolution::direct_fir<Float>{};
+    fir.filter(taps.to_mdspan());
+
+    auto output = signal;
+    for (auto i{0zu}; i < output.extent(0); i += block_size) {
+        auto const last = std::min(i + block_size, output.extent(0));
+        fir(stdex::submdspan(output.to_mdspan(), std::tuple{i, last}));
+    }
+
+    for (auto i{0zu}; i < output.extent(0); ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(output(i), Catch::Matchers::WithinAbs(expected(i), 0.0001));
+    }
+
+    fir.reset();
+    auto impulse = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{num_taps};
+    impulse(0)   = Float(1);
+    fir(impulse.to_mdspan());
+    for (auto i{0zu}; i < num_taps; ++i) {
+        REQUIRE(impulse(i) == taps(i));
+    }
+}
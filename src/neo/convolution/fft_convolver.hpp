@@ -5,11 +5,11 @@
 #include <neo/algorithm/copy.hpp>
 #include <neo/algorithm/fill.hpp>
 #include <neo/algorithm/multiply.hpp>
-#include <neo/algorithm/scale.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/convolution/mode.hpp>
 #include <neo/fft/rfft.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <utility>
 
@@ -63,13 +63,12 @@ private:
     {
         auto const tmp = _tmp.to_mdspan();
         irfft(_plan, in, tmp);
-        scale(Float(1) / Float(_plan.size()), tmp);
         copy(stdex::submdspan(tmp, std::tuple{0, output_size()}), out);
     }
 
     std::size_t _signal_size;
     std::size_t _patch_size;
-    fft::rfft_plan<Float> _plan{fft::from_order, fft::next_order(output_size())};
+    fft::rfft_plan<Float> _plan{fft::from_order, fft::next_order(std::max(output_size(), 2zu)), fft::norm::backward};
 
     stdex::mdarray<Float, stdex::dextents<size_t, 1>> _tmp{_plan.size()};
     stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 1>> _signal_spectrum{_plan.size() / 2 + 1};
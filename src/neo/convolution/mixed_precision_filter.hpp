@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/convolution/dense_filter.hpp>
+#include <neo/convolution/quantized_filter.hpp>
+#include <neo/convolution/quantized_span.hpp>
+#include <neo/convolution/sparsity.hpp>
+#include <neo/fixed_point/fixed_point.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace neo::convolution {
+
+/// Storage precision of one filter partition
+/// \ingroup neo-convolution
+enum struct partition_precision : std::uint8_t
+{
+    float32,
+    float16,
+    int8,
+    none,
+};
+
+namespace detail {
+
+#if defined(NEO_HAS_BUILTIN_FLOAT16)
+using half_precision_t = _Float16;
+#else
+using half_precision_t = q15;
+#endif
+
+/// Weighted energy of a partition, DC & nyquist count once
+[[nodiscard]] auto partition_energy(in_vector auto partition) -> double
+{
+    auto energy = 0.0;
+    for (auto col{0zu}; col < partition.extent(0); ++col) {
+        energy += bin_power(partition[col]) * bin_energy_weight(col, partition.extent(0));
+    }
+    return energy;
+}
+
+/// Weighted energy of the difference between a partition and its quantized version
+template<quantized_value Quantized>
+[[nodiscard]] auto quantization_error(in_vector auto partition) -> double
+{
+    auto storage = std::vector<Quantized>(partition.extent(0) * 2zu);
+    auto const q = quantized_span<Quantized>{
+        storage.data(),
+        quantize_row(partition, storage.data()),
+        partition.extent(0),
+    };
+
+    auto error = 0.0;
+    for (auto col{0zu}; col < partition.extent(0); ++col) {
+        auto const re = static_cast<double>(partition[col].real()) - static_cast<double>(q.real(col));
+        auto const im = static_cast<double>(partition[col].imag()) - static_cast<double>(q.imag(col));
+        error += (re * re + im * im) * bin_energy_weight(col, partition.extent(0));
+    }
+    return error;
+}
+
+}  // namespace detail
+
+/// Filter storing every partition in the cheapest precision that keeps a target SNR.
+///
+/// The error budget (total filter energy scaled by -snr_db) is split evenly across
+/// all partitions. Each partition is then dropped, stored as int8, float16 (q15 if
+/// _Float16 is unavailable) or float32, whichever is the first to stay within its
+/// share. Loud head partitions end up in float32, the decaying tail in int8 or
+/// not at all.
+///
+/// \ingroup neo-convolution
+template<complex Complex>
+    requires std::same_as<value_type_t<Complex>, float>
+struct mixed_precision_filter
+{
+    using value_type       = Complex;
+    using half_type        = detail::half_precision_t;
+    using accumulator_type = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>;
+
+    static constexpr auto default_snr_db = 90.0;
+
+    mixed_precision_filter() = default;
+
+    auto filter(in_matrix_of<Complex> auto filter, double snr_db = default_snr_db) -> void;
+
+    [[nodiscard]] auto precision(std::size_t partition) const noexcept -> partition_precision;
+
+    /// Expected signal-to-error ratio of the stored filter in dB
+    [[nodiscard]] auto snr_db() const noexcept -> double;
+
+    template<in_vector_of<Complex> FdlRow, std::integral Index, inout_vector_of<Complex> Accumulator>
+    auto operator()(FdlRow fdl, Index filter_index, Accumulator accumulator) -> void;
+
+private:
+    stdex::mdarray<partition_precision, stdex::dextents<size_t, 1>> _precision;
+    stdex::mdarray<size_t, stdex::dextents<size_t, 1>> _rows;
+    double _snr_db{std::numeric_limits<double>::infinity()};
+
+    dense_filter<Complex> _float32;
+    quantized_filter<Complex, half_type> _float16;
+    quantized_filter<Complex, std::int8_t> _int8;
+};
+
+template<complex Complex>
+    requires std::same_as<value_type_t<Complex>, float>
+auto mixed_precision_filter<Complex>::filter(in_matrix_of<Complex> auto filter, double snr_db) -> void
+{
+    auto const num_partitions = filter.extent(0);
+    auto const num_bins       = filter.extent(1);
+
+    _precision = stdex::mdarray<partition_precision, stdex::dextents<size_t, 1>>{num_partitions};
+    _rows      = stdex::mdarray<size_t, stdex::dextents<size_t, 1>>{num_partitions};
+
+    auto total = 0.0;
+    for (auto p{0zu}; p < num_partitions; ++p) {
+        total += detail::partition_energy(stdex::submdspan(filter, p, stdex::full_extent));
+    }
+
+    auto const budget = total * std::pow(10.0, -snr_db / 10.0) / static_cast<double>(std::max(num_partitions, 1zu));
+
+    auto counts = std::array<std::size_t, 4>{};
+    auto error  = 0.0;
+    for (auto p{0zu}; p < num_partitions; ++p) {
+        auto const partition = stdex::submdspan(filter, p, stdex::full_extent);
+
+        auto precision     = partition_precision::float32;
+        auto const dropped = detail::partition_energy(partition);
+        if (dropped <= budget) {
+            precision = partition_precision::none;
+            error += dropped;
+        } else if (auto const e = detail::quantization_error<std::int8_t>(partition); e <= budget) {
+            precision = partition_precision::int8;
+            error += e;
+        } else if (auto const h = detail::quantization_error<half_type>(partition); h <= budget) {
+            precision = partition_precision::float16;
+            error += h;
+        }
+
+        _precision(p) = precision;
+        _rows(p)      = counts[static_cast<std::size_t>(precision)]++;
+    }
+
+    _snr_db = error > 0.0 ? 10.0 * std::log10(total / error) : std::numeric_limits<double>::infinity();
+
+    // Gather the partitions of each precision into their own contiguous matrix
+    auto const gather = [&](partition_precision precision) {
+        auto const rows = counts[static_cast<std::size_t>(precision)];
+        auto matrix     = stdex::mdarray<Complex, stdex::dextents<size_t, 2>>{rows, num_bins};
+        for (auto p{0zu}; p < num_partitions; ++p) {
+            if (_precision(p) != precision) {
+                continue;
+            }
+            for (auto col{0zu}; col < num_bins; ++col) {
+                matrix(_rows(p), col) = filter(p, col);
+            }
+        }
+        return matrix;
+    };
+
+    _float32.filter(gather(partition_precision::float32).to_mdspan());
+    _float16.filter(gather(partition_precision::float16).to_mdspan());
+    _int8.filter(gather(partition_precision::int8).to_mdspan());
+}
+
+template<complex Complex>
+    requires std::same_as<value_type_t<Complex>, float>
+auto mixed_precision_filter<Complex>::precision(std::size_t partition) const noexcept -> partition_precision
+{
+    return _precision(partition);
+}
+
+template<complex Complex>
+    requires std::same_as<value_type_t<Complex>, float>
+auto mixed_precision_filter<Complex>::snr_db() const noexcept -> double
+{
+    return _snr_db;
+}
+
+template<complex Complex>
+    requires std::same_as<value_type_t<Complex>, float>
+template<in_vector_of<Complex> FdlRow, std::integral Index, inout_vector_of<Complex> Accumulator>
+auto mixed_precision_filter<Complex>::operator()(FdlRow fdl, Index filter_index, Accumulator accumulator) -> void
+{
+    auto const row = _rows(static_cast<std::size_t>(filter_index));
+    switch (_precision(static_cast<std::size_t>(filter_index))) {
+        case partition_precision::float32: _float32(fdl, row, accumulator); break;
+        case partition_precision::float16: _float16(fdl, row, accumulator); break;
+        case partition_precision::int8: _int8(fdl, row, accumulator); break;
+        case partition_precision::none: break;
+    }
+}
+
+}  // namespace neo::convolution
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT
+
+#include "mixed_precision_filter.hpp"
+
+#include <neo/convolution/dense_convolver.hpp>
+#include <neo/convolution/quantized_convolver.hpp>
+#include <neo/convolution/uniform_partition.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <cmath>
+
+TEMPLATE_TEST_CASE("neo/convolution: mixed_precision_filter", "", std::complex<float>, neo::complex64)
+{
+    using Complex = TestType;
+    using Filter  = neo::convolution::mixed_precision_filter<Complex>;
+
+    STATIC_REQUIRE(std::same_as<typename Filter::value_type, Complex>);
+
+    auto const snr_db = GENERATE(30.0, 60.0, 90.0);
+    CAPTURE(snr_db);
+
+    // Noise decaying by 10 dB per partition
+    auto const num_partitions = 16zu;
+    auto const num_bins       = 65zu;
+    auto const noise = neo::generate_noise_signal<Complex>(num_partitions * num_bins, Catch::getSeed());
+    auto matrix      = stdex::mdarray<Complex, stdex::dextents<size_t, 2>>{num_partitions, num_bins};
+    for (auto p{0zu}; p < num_partitions; ++p) {
+        auto const gain = std::pow(10.0F, -0.5F * static_cast<float>(p));
+        for (auto b{0zu}; b < num_bins; ++b) {
+            matrix(p, b) = noise(p * num_bins + b) * gain;
+        }
+    }
+
+    auto filter = Filter{};
+    filter.filter(matrix.to_mdspan(), snr_db);
+    REQUIRE(filter.snr_db() >= snr_db);
+    REQUIRE(filter.precision(num_partitions - 1) == neo::convolution::partition_precision::none);
+    if (snr_db > 60.0) {
+        REQUIRE(filter.precision(0) == neo::convolution::partition_precision::float32);
+    }
+
+    // Precision never increases towards the quieter tail
+    for (auto p{1zu}; p < num_partitions; ++p) {
+        CAPTURE(p);
+        REQUIRE(filter.precision(p) >= filter.precision(p - 1));
+    }
+
+    auto zeros = stdex::mdarray<Complex, stdex::dextents<size_t, 2>>{num_partitions, num_bins};
+    filter.filter(zeros.to_mdspan());
+    REQUIRE(filter.precision(0) == neo::convolution::partition_precision::none);
+    REQUIRE(std::isinf(filter.snr_db()));
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: mixed_precision_upols_convolver", "", std::complex<float>)
+{
+    using Complex = TestType;
+
+    auto const snr_db     = GENERATE(40.0, 80.0);
+    auto const block_size = GENERATE(as<std::size_t>{}, 128, 256);
+    CAPTURE(snr_db);
+    CAPTURE(block_size);
+
+    // Exponentially decaying noise, 60 dB over the whole impulse response
+    auto impulse = neo::generate_noise_signal<float>(block_size * 8zu, Catch::getSeed());
+    for (auto i{0zu}; i < impulse.extent(0); ++i) {
+        auto const t = static_cast<float>(i) / static_cast<float>(impulse.extent(0));
+        impulse(i) *= std::pow(10.0F, -3.0F * t);
+    }
+
+    auto const matrix  = stdex::mdspan{impulse.data(), stdex::extents{1zu, impulse.extent(0)}};
+    auto const filter  = neo::convolution::uniform_partition(matrix, block_size);
+    auto const channel = stdex::submdspan(filter.to_mdspan(), 0, stdex::full_extent, stdex::full_extent);
+
+    auto const signal = neo::generate_noise_signal<float>(block_size * 16zu, Catch::getSeed() + 1U);
+    auto expected     = signal;
+    auto actual       = signal;
+
+    auto dense = neo::convolution::upols_convolver<Complex>{};
+    auto mixed = neo::convolution::mixed_precision_upols_convolver<Complex>{};
+    dense.filter(channel);
+    mixed.filter(channel, snr_db);
+
+    for (std::size_t i{0}; i < signal.extent(0); i += block_size) {
+        dense(stdex::submdspan(expected.to_mdspan(), std::tuple{i, i + block_size}));
+        mixed(stdex::submdspan(actual.to_mdspan(), std::tuple{i, i + block_size}));
+    }
+
+    auto power = 0.0;
+    auto error = 0.0;
+    for (auto i{0zu}; i < signal.extent(0); ++i) {
+        auto const diff = static_cast<double>(expected(i) - actual(i));
+        power += static_cast<double>(expected(i)) * static_cast<double>(expected(i));
+        error += diff * diff;
+    }
+
+    // White input, so the output error follows the filter error with some slack for the noise estimate
+    REQUIRE(10.0 * std::log10(power / error) > snr_db - 6.0);
+}
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/container/mdspan.hpp>
+#include <neo/parallel/thread_pool.hpp>
+
+#include <cassert>
+#include <vector>
+
+namespace neo::convolution {
+
+/// One \p Convolver per channel, optionally run in parallel on a thread_pool
+/// \ingroup neo-convolution
+template<typename Convolver>
+struct multichannel_convolver
+{
+    using value_type     = typename Convolver::value_type;
+    using convolver_type = Convolver;
+
+    multichannel_convolver() = default;
+
+    [[nodiscard]] auto num_channels() const noexcept -> std::size_t { return _convolvers.size(); }
+
+    /// filter is channels x partitions x bins
+    template<typename Filter>
+        requires(is_mdspan<Filter> and Filter::rank() == 3)
+    auto filter(Filter filter, auto... args) -> void;
+
+    auto operator()(inout_matrix auto block) -> void;
+    auto operator()(inout_matrix auto block, thread_pool& pool) -> void;
+
+private:
+    std::vector<Convolver> _convolvers;
+};
+
+template<typename Convolver>
+template<typename Filter>
+    requires(is_mdspan<Filter> and Filter::rank() == 3)
+auto multichannel_convolver<Convolver>::filter(Filter filter, auto... args) -> void
+{
+    _convolvers.resize(filter.extent(0));
+    for (auto ch{0zu}; ch < _convolvers.size(); ++ch) {
+        _convolvers[ch].filter(stdex::submdspan(filter, ch, stdex::full_extent, stdex::full_extent), args...);
+    }
+}
+
+template<typename Convolver>
+auto multichannel_convolver<Convolver>::operator()(inout_matrix auto block) -> void
+{
+    assert(block.extent(0) == num_channels());
+
+    for (auto ch{0zu}; ch < _convolvers.size(); ++ch) {
+        _convolvers[ch](stdex::submdspan(block, ch, stdex::full_extent));
+    }
+}
+
+template<typename Convolver>
+auto multichannel_convolver<Convolver>::operator()(inout_matrix auto block, thread_pool& pool) -> void
+{
+    assert(block.extent(0) == num_channels());
+
+    pool.parallel_for(_convolvers.size(), [this, block](std::size_t /*worker*/, std::size_t ch) {
+        _convolvers[ch](stdex::submdspan(block, ch, stdex::full_extent));
+    });
+}
+
+}  // namespace neo::convolution
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+
+#include "multichannel_convolver.hpp"
+
+#include <neo/convolution/dense_convolver.hpp>
+#include <neo/convolution/uniform_partition.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+TEMPLATE_TEST_CASE(
+    "neo/convolution: multichannel_convolver",
+    "",
+    neo::convolution::upols_convolver<std::complex<float>>,
+    neo::convolution::upola_convolver<std::complex<double>>
+)
+{
+    using Convolver = TestType;
+    using Float     = typename Convolver::value_type::value_type;
+
+    auto const num_channels = GENERATE(as<std::size_t>{}, 1, 2, 9);
+    auto const num_workers  = GENERATE(as<std::size_t>{}, 0, 3);
+    auto const block_size   = 128zu;
+    CAPTURE(num_channels);
+    CAPTURE(num_workers);
+
+    auto const noise   = neo::generate_noise_signal<Float>(num_channels * block_size * 5zu, Catch::getSeed());
+    auto const impulse = stdex::mdspan{noise.data(), stdex::extents{num_channels, block_size * 5zu}};
+    auto const filter  = neo::convolution::uniform_partition(impulse, block_size);
+
+    auto serial   = neo::convolution::multichannel_convolver<Convolver>{};
+    auto parallel = neo::convolution::multichannel_convolver<Convolver>{};
+    serial.filter(filter.to_mdspan());
+    parallel.filter(filter.to_mdspan());
+    REQUIRE(serial.num_channels() == num_channels);
+
+    auto reference = std::vector<Convolver>(num_channels);
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        reference[ch].filter(stdex::submdspan(filter.to_mdspan(), ch, stdex::full_extent, stdex::full_extent));
+    }
+
+    auto pool = neo::thread_pool{num_workers};
+    for (auto i{0}; i < 8; ++i) {
+        auto const input = neo::generate_noise_signal<Float>(num_channels * block_size, Catch::getSeed() + 1U);
+        auto a           = input;
+        auto b           = input;
+        auto c           = input;
+
+        auto const block = [num_channels, block_size](auto& buffer) {
+            return stdex::mdspan{buffer.data(), stdex::extents{num_channels, block_size}};
+        };
+
+        serial(block(a));
+        parallel(block(b), pool);
+        for (auto ch{0zu}; ch < num_channels; ++ch) {
+            reference[ch](stdex::submdspan(block(c), ch, stdex::full_extent));
+        }
+
+        for (auto j{0zu}; j < input.extent(0); ++j) {
+            REQUIRE(a(j) == c(j));
+            REQUIRE(b(j) == c(j));
+        }
+    }
+}
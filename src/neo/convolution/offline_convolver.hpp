@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/algorithm/copy.hpp>
+#include <neo/algorithm/fill.hpp>
+#include <neo/algorithm/multiply.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/convolution/mode.hpp>
+#include <neo/fft/rfft.hpp>
+#include <neo/parallel/thread_pool.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace neo::convolution {
+
+/// Transform size with the lowest estimated cost per output sample for an offline overlap-add
+/// \ingroup neo-convolution
+[[nodiscard]] inline auto offline_transform_size(std::size_t signal_size, std::size_t patch_size) -> std::size_t
+{
+    auto const full = std::bit_ceil(std::max(output_size<mode::full>(signal_size, patch_size), 2zu));
+
+    auto const cost = [patch_size](std::size_t n) {
+        auto const size = static_cast<double>(n);
+        auto const hop  = static_cast<double>(n - patch_size + 1zu);
+        return (size * std::log2(size) + size) / hop;
+    };
+
+    auto best = std::min(std::bit_ceil(std::max(patch_size * 2zu, 2zu)), full);
+    for (auto n = best * 2zu; n <= full; n *= 2zu) {
+        if (cost(n) < cost(best)) {
+            best = n;
+        }
+    }
+    return best;
+}
+
+/// Full linear convolution of whole multichannel buffers, optimized for throughput.
+///
+/// The signal is cut into segments of transform_size() - patch_size + 1 samples, which
+/// are convolved with a single forward and inverse transform each. All channels and
+/// segments run in parallel. Neighbouring segments overlap in the output, so even and
+/// odd segments are processed in two passes without any locking.
+///
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+struct offline_convolver
+{
+    using value_type = Float;
+
+    offline_convolver(
+        std::size_t signal_size,
+        std::size_t patch_size,
+        std::size_t num_threads = std::max(std::thread::hardware_concurrency(), 1U)
+    );
+
+    [[nodiscard]] auto signal_size() const noexcept -> std::size_t { return _signal_size; }
+
+    [[nodiscard]] auto patch_size() const noexcept -> std::size_t { return _patch_size; }
+
+    [[nodiscard]] auto transform_size() const noexcept -> std::size_t { return _transform_size; }
+
+    [[nodiscard]] auto num_threads() const noexcept -> std::size_t { return _pool.concurrency(); }
+
+    [[nodiscard]] auto output_size() const noexcept -> std::size_t
+    {
+        return convolution::output_size<mode::full>(signal_size(), patch_size());
+    }
+
+    /// Convolves every row of signal with the matching row of patch
+    template<in_matrix_of<Float> Signal, in_matrix_of<Float> Patch, out_matrix_of<Float> Output>
+    auto operator()(Signal signal, Patch patch, Output output) -> void;
+
+private:
+    struct workspace
+    {
+        explicit workspace(std::size_t order)
+            : plan{fft::from_order, order, fft::norm::backward}
+            , buffer{plan.size()}
+            , spectrum{plan.size() / 2zu + 1zu}
+        {}
+
+        fft::rfft_plan<Float> plan;
+        stdex::mdarray<Float, stdex::dextents<size_t, 1>> buffer;
+        stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 1>> spectrum;
+    };
+
+    auto transform_forward(workspace& ws, in_vector auto in, out_vector auto out) -> void;
+
+    std::size_t _signal_size;
+    std::size_t _patch_size;
+    std::size_t _transform_size;
+
+    thread_pool _pool;
+    std::vector<workspace> _workspaces;
+    stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 2>> _patch_spectra;
+};
+
+template<std::floating_point Float>
+offline_convolver<Float>::offline_convolver(std::size_t signal_size, std::size_t patch_size, std::size_t num_threads)
+    : _signal_size{signal_size}
+    , _patch_size{patch_size}
+    , _transform_size{offline_transform_size(signal_size, patch_size)}
+    , _pool{std::max(num_threads, 1zu) - 1zu, false}
+{
+    assert(_signal_size > 0);
+    assert(_patch_size > 0);
+
+    _workspaces.reserve(_pool.concurrency());
+    for (auto i{0zu}; i < _pool.concurrency(); ++i) {
+        _workspaces.emplace_back(fft::next_order(_transform_size));
+    }
+}
+
+template<std::floating_point Float>
+auto offline_convolver<Float>::transform_forward(workspace& ws, in_vector auto in, out_vector auto out) -> void
+{
+    auto const buffer = ws.buffer.to_mdspan();
+    copy(in, stdex::submdspan(buffer, std::tuple{0zu, in.extent(0)}));
+    fill(stdex::submdspan(buffer, std::tuple{in.extent(0), buffer.extent(0)}), Float(0));
+    fft::rfft(ws.plan, buffer, out);
+}
+
+template<std::floating_point Float>
+template<in_matrix_of<Float> Signal, in_matrix_of<Float> Patch, out_matrix_of<Float> Output>
+auto offline_convolver<Float>::operator()(Signal signal, Patch patch, Output output) -> void
+{
+    assert(signal.extent(0) == patch.extent(0));
+    assert(signal.extent(0) == output.extent(0));
+    assert(signal.extent(1) == signal_size());
+    assert(patch.extent(1) == patch_size());
+    assert(output.extent(1) == output_size());
+
+    auto const num_channels = signal.extent(0);
+    auto const num_bins     = _transform_size / 2zu + 1zu;
+    auto const hop          = _transform_size - _patch_size + 1zu;
+    auto const num_segments = (_signal_size + hop - 1zu) / hop;
+
+    if (_patch_spectra.extent(0) != num_channels) {
+        _patch_spectra = stdex::mdarray<std::complex<Float>, stdex::dextents<size_t, 2>>{num_channels, num_bins};
+    }
+
+    auto const spectra = _patch_spectra.to_mdspan();
+    _pool.parallel_for(num_channels, [&](std::size_t worker, std::size_t ch) {
+        auto const row = stdex::submdspan(patch, ch, stdex::full_extent);
+        transform_forward(_workspaces[worker], row, stdex::submdspan(spectra, ch, stdex::full_extent));
+        fill(stdex::submdspan(output, ch, stdex::full_extent), Float(0));
+    });
+
+    auto const convolve_segment = [&](std::size_t worker, std::size_t ch, std::size_t segment) {
+        auto& ws = _workspaces[worker];
+
+        auto const start    = segment * hop;
+        auto const input    = stdex::submdspan(signal, ch, std::tuple{start, std::min(start + hop, _signal_size)});
+        auto const spectrum = ws.spectrum.to_mdspan();
+        transform_forward(ws, input, spectrum);
+        multiply(spectrum, stdex::submdspan(spectra, ch, stdex::full_extent), spectrum);
+        fft::irfft(ws.plan, spectrum, ws.buffer.to_mdspan());
+
+        auto const size = std::min(_transform_size, output_size() - start);
+        for (auto i{0zu}; i < size; ++i) {
+            output(ch, start + i) += ws.buffer(i);
+        }
+    };
+
+    // The output of segment n overlaps with n-1 and n+1, but never with n+2
+    for (auto parity : {0zu, 1zu}) {
+        auto const segments = (num_segments + 1zu - parity) / 2zu;
+        _pool.parallel_for(num_channels * segments, [&](std::size_t worker, std::size_t item) {
+            convolve_segment(worker, item % num_channels, (item / num_channels) * 2zu + parity);
+        });
+    }
+}
+
+/// \ingroup neo-convolution
+template<in_matrix Signal, in_matrix Patch>
+    requires(std::floating_point<value_type_t<Signal>> and std::same_as<value_type_t<Signal>, value_type_t<Patch>>)
+[[nodiscard]] auto offline_convolve(Signal signal, Patch patch)
+{
+    using Float = value_type_t<Signal>;
+
+    assert(signal.extent(0) == patch.extent(0));
+    if (signal.extent(1) == 0 or patch.extent(1) == 0) {
+        return stdex::mdarray<Float, stdex::dextents<size_t, 2>>{signal.extent(0), 0zu};
+    }
+
+    auto convolver = offline_convolver<Float>{signal.extent(1), patch.extent(1)};
+    auto output    = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{signal.extent(0), convolver.output_size()};
+    convolver(signal, patch, output.to_mdspan());
+    return output;
+}
+
+}  // namespace neo::convolution
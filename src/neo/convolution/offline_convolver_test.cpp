@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MIT
+
+#include "offline_convolver.hpp"
+
+#include <neo/algorithm/allclose.hpp>
+#include <neo/convolution/fft_convolver.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <bit>
+
+TEST_CASE("neo/convolution: offline_transform_size")
+{
+    using namespace neo::convolution;
+
+    REQUIRE(offline_transform_size(1, 1) == 2);
+    REQUIRE(offline_transform_size(16, 16) == 32);
+    REQUIRE(offline_transform_size(100, 10) == 64);
+
+    auto const patch_size = GENERATE(as<std::size_t>{}, 1, 7, 64, 1000, 48000);
+    auto const size       = offline_transform_size(1zu << 30zu, patch_size);
+    CAPTURE(patch_size);
+    REQUIRE(std::has_single_bit(size));
+    REQUIRE(size >= patch_size * 2zu);
+    REQUIRE(size <= std::max(patch_size * 64zu, 64zu));
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: offline_convolver", "", float, double)
+{
+    using Float = TestType;
+
+    auto const num_channels = GENERATE(as<std::size_t>{}, 1, 2, 3);
+    auto const num_threads  = GENERATE(as<std::size_t>{}, 1, 4);
+    auto const signal_size  = GENERATE(as<std::size_t>{}, 1, 17, 1000, 10000);
+    auto const patch_size   = GENERATE(as<std::size_t>{}, 1, 16, 333);
+    CAPTURE(num_channels);
+    CAPTURE(num_threads);
+    CAPTURE(signal_size);
+    CAPTURE(patch_size);
+
+    auto const noise  = neo::generate_noise_signal<Float>(num_channels * signal_size, Catch::getSeed());
+    auto const taps   = neo::generate_noise_signal<Float>(num_channels * patch_size, Catch::getSeed() + 1U);
+    auto const signal = stdex::mdspan{noise.data(), stdex::extents{num_channels, signal_size}};
+    auto const patch  = stdex::mdspan{taps.data(), stdex::extents{num_channels, patch_size}};
+
+    auto convolver = neo::convolution::offline_convolver<Float>{signal_size, patch_size, num_threads};
+    auto output    = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{num_channels, convolver.output_size()};
+    REQUIRE(convolver.num_threads() == num_threads);
+    REQUIRE(std::has_single_bit(convolver.transform_size()));
+
+    // Run twice, the output is overwritten and not accumulated
+    convolver(signal, patch, output.to_mdspan());
+    convolver(signal, patch, output.to_mdspan());
+
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        auto const expected = neo::convolution::fft_convolve(
+            stdex::submdspan(signal, ch, stdex::full_extent),
+            stdex::submdspan(patch, ch, stdex::full_extent)
+        );
+        auto const actual = stdex::submdspan(output.to_mdspan(), ch, stdex::full_extent);
+        REQUIRE(neo::allclose(expected.to_mdspan(), actual, Float(1e-3)));
+    }
+
+    auto const returned = neo::convolution::offline_convolve(signal, patch);
+    REQUIRE(returned.extent(0) == num_channels);
+    REQUIRE(returned.extent(1) == signal_size + patch_size - 1zu);
+}
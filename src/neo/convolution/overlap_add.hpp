@@ -7,7 +7,6 @@
 #include <neo/algorithm/add.hpp>
 #include <neo/algorithm/copy.hpp>
 #include <neo/algorithm/fill.hpp>
-#include <neo/algorithm/scale.hpp>
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/convolution/mode.hpp>
@@ -43,6 +42,7 @@ private:
     fft::rfft_plan<real_type, complex_type> _rfft{
         fft::from_order,
         fft::next_order(output_size<mode::full>(_block_size, _filter_size)),
+        fft::norm::backward,
     };
 
     stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _window{_rfft.size()};
@@ -95,9 +95,8 @@ auto overlap_add<Complex>::operator()(inout_vector auto block, auto callback) ->
     // Convolve
     callback(spectrum);
 
-    // K-point irfft
+    // K-point irfft, normalized by the plan
     irfft(_rfft, spectrum, window);
-    scale(real_type(1) / static_cast<real_type>(_rfft.size()), window);
 
     // Copy to output
     add(signal, overlap, block);
@@ -7,7 +7,6 @@
 #include <neo/algorithm/add.hpp>
 #include <neo/algorithm/copy.hpp>
 #include <neo/algorithm/fill.hpp>
-#include <neo/algorithm/scale.hpp>
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/fft/rfft.hpp>
@@ -38,7 +37,7 @@ private:
     size_type _input_pos{0};
     size_type _current_segment{0};
 
-    fft::rfft_plan<real_type> _rfft{fft::from_order, fft::next_order(size_type(4))};
+    fft::rfft_plan<real_type> _rfft{fft::from_order, fft::next_order(size_type(4)), fft::norm::backward};
 
     stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _real_window{_rfft.size()};
     stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _overlap{_rfft.size()};
@@ -57,7 +56,11 @@ auto overlap_add_convolver<Complex, Fdl, Filter>::filter(in_matrix_of<Complex> a
     _block_size   = f.extent(1) - 1;
     _num_segments = f.extent(0);
 
-    _rfft           = fft::rfft_plan<real_type>{fft::from_order, fft::next_order(_block_size * 2U)};
+    _rfft           = fft::rfft_plan<real_type>{
+        fft::from_order,
+        fft::next_order(_block_size * 2U),
+        fft::norm::backward,
+    };
     _complex_window = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>{_rfft.size() / 2 + 1};
     _real_window    = stdex::mdarray<real_type, stdex::dextents<size_t, 1>>{_rfft.size()};
     _overlap        = stdex::mdarray<real_type, stdex::dextents<size_t, 1>>{_rfft.size()};
@@ -112,7 +115,6 @@ auto overlap_add_convolver<Complex, Fdl, Filter>::operator()(inout_vector_of<rea
         copy(accumulator, complex_window);
 
         irfft(_rfft, complex_window, real_window);
-        scale(real_type(1) / static_cast<real_type>(_rfft.size()), real_window);
 
         auto sub_overlap = stdex::submdspan(overlap, std::tuple{_input_pos, _input_pos + num_to_process});
         add(sub_window, sub_overlap, sub_inout);
@@ -6,11 +6,11 @@
 
 #include <neo/algorithm/copy.hpp>
 #include <neo/algorithm/fill.hpp>
-#include <neo/algorithm/scale.hpp>
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/fft.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 
@@ -34,25 +34,21 @@ struct overlap_save
     auto operator()(inout_vector auto block, auto callback) -> void;
 
 private:
-    auto slide_window_left(auto window) -> void
-    {
-        auto const step      = static_cast<int>(block_size());
-        auto const num_steps = static_cast<int>(window.extent(0)) / step;
-        for (auto i{0}; i < num_steps - 1; ++i) {
-            auto const dest_idx = i * step;
-            auto const src_idx  = dest_idx + step;
-
-            auto const src_block  = stdex::submdspan(window, std::tuple{src_idx, src_idx + step});
-            auto const dest_block = stdex::submdspan(window, std::tuple{dest_idx, src_idx});
-            copy(src_block, dest_block);
-        }
-    }
+    auto push_block(in_vector auto block) -> void;
 
     size_type _block_size;
     size_type _filter_size;
-    fft::rfft_plan<real_type, complex_type> _plan{fft::from_order, fft::next_order(_block_size + _filter_size - 1zu)};
+    fft::rfft_plan<real_type, complex_type> _plan{
+        fft::from_order,
+        fft::next_order(_block_size + _filter_size - 1zu),
+        fft::norm::backward,
+    };
+
+    // Circular history of the last transform_size() samples, mirrored into the upper half. The window starting
+    // at the write position (oldest sample) is always contiguous and is passed to the rfft without a copy.
+    stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _window{_plan.size() * 2zu};
+    size_type _write_pos{0};
 
-    stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _window{_plan.size()};
     stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _real_buffer{_plan.size()};
     stdex::mdarray<complex_type, stdex::dextents<size_t, 1>> _complex_buffer{_plan.size()};
 };
@@ -87,12 +83,8 @@ auto overlap_save<Complex>::operator()(inout_vector auto block, auto callback) -
     assert(block.extent(0) == block_size());
 
     // Time domain input buffer
-    auto const window       = _window.to_mdspan();
-    auto const keep_extents = std::tuple{transform_size() - block_size(), transform_size()};
-
-    auto const dest_in_window = stdex::submdspan(window, keep_extents);
-    slide_window_left(window);
-    copy(block, dest_in_window);
+    push_block(block);
+    auto const window = stdex::submdspan(_window.to_mdspan(), std::tuple{_write_pos, _write_pos + transform_size()});
 
     // 2B-point R2C-FFT
     auto const complex_buf = _complex_buffer.to_mdspan();
@@ -102,13 +94,35 @@ auto overlap_save<Complex>::operator()(inout_vector auto block, auto callback) -
     auto const coeffs = stdex::submdspan(complex_buf, std::tuple{0zu, _plan.size() / 2zu + 1zu});
     callback(coeffs);
 
-    // 2B-point C2R-IFFT
+    // 2B-point C2R-IFFT, normalized by the plan
     auto const real_buf = _real_buffer.to_mdspan();
     irfft(_plan, complex_buf, real_buf);
-    scale(real_type(1) / static_cast<real_type>(_plan.size()), real_buf);
 
     // Copy block_size samples to output
-    copy(stdex::submdspan(real_buf, keep_extents), block);
+    copy(stdex::submdspan(real_buf, std::tuple{transform_size() - block_size(), transform_size()}), block);
+}
+
+template<complex Complex>
+auto overlap_save<Complex>::push_block(in_vector auto block) -> void
+{
+    auto const size   = transform_size();
+    auto const window = _window.to_mdspan();
+
+    // Write at most two contiguous chunks, each into both halves of the mirrored buffer
+    auto const head = std::min(block_size(), size - _write_pos);
+    auto const tail = block_size() - head;
+
+    auto const first = stdex::submdspan(block, std::tuple{0zu, head});
+    copy(first, stdex::submdspan(window, std::tuple{_write_pos, _write_pos + head}));
+    copy(first, stdex::submdspan(window, std::tuple{_write_pos + size, _write_pos + size + head}));
+
+    if (tail > 0) {
+        auto const second = stdex::submdspan(block, std::tuple{head, block_size()});
+        copy(second, stdex::submdspan(window, std::tuple{0zu, tail}));
+        copy(second, stdex::submdspan(window, std::tuple{size, size + tail}));
+    }
+
+    _write_pos = (_write_pos + block_size()) % size;
 }
 
 }  // namespace neo::convolution
@@ -4,9 +4,13 @@
 #include "overlap_save.hpp"
 
 #include <neo/algorithm/allclose.hpp>
+#include <neo/algorithm/copy.hpp>
+#include <neo/algorithm/multiply.hpp>
 #include <neo/algorithm/root_mean_squared_error.hpp>
 #include <neo/complex/scalar_complex.hpp>
+#include <neo/convolution/direct_convolve.hpp>
 #include <neo/convolution/uniform_partition.hpp>
+#include <neo/fft/rfft.hpp>
 #include <neo/testing/testing.hpp>
 
 #include <catch2/catch_approx.hpp>
@@ -62,3 +66,37 @@ TEMPLATE_PRODUCT_TEST_CASE(
 {
     test_overlap<TestType>();
 }
+
+TEMPLATE_TEST_CASE("neo/convolution: overlap_save(filter)", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const block_size  = GENERATE(as<std::size_t>{}, 96, 128, 200);
+    auto const filter_size = GENERATE(as<std::size_t>{}, 8, 33, 127, 300);
+
+    auto const signal = neo::generate_noise_signal<Float>(block_size * 8zu, Catch::getSeed());
+    auto const filter = neo::generate_noise_signal<Float>(filter_size, Catch::getSeed() + 1U);
+
+    auto overlap = neo::convolution::overlap_save<Complex>{block_size, filter_size};
+    auto const K = overlap.transform_size();
+
+    auto plan     = neo::fft::rfft_plan<Float>{neo::fft::from_order, neo::fft::next_order(K)};
+    auto padded   = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{K};
+    auto spectrum = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{K / 2zu + 1zu};
+    neo::copy(filter.to_mdspan(), stdex::submdspan(padded.to_mdspan(), std::tuple{0zu, filter_size}));
+    neo::fft::rfft(plan, padded.to_mdspan(), spectrum.to_mdspan());
+
+    auto output = signal;
+    auto blocks = stdex::mdspan{output.data(), stdex::extents{output.size()}};
+    for (std::size_t i{0}; i < output.size(); i += block_size) {
+        auto block = stdex::submdspan(blocks, std::tuple{i, i + block_size});
+        overlap(block, [&](neo::inout_vector auto io) { neo::multiply(io, spectrum.to_mdspan(), io); });
+    }
+
+    auto const expected = neo::convolution::direct_convolve(signal.to_mdspan(), filter.to_mdspan());
+    for (auto i{0zu}; i < output.size(); ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(output(i), Catch::Matchers::WithinAbs(expected(i), 0.0001));
+    }
+}
@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/algorithm/dot.hpp>
+#include <neo/algorithm/fill.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/math/windowing.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <numbers>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace neo::convolution {
+
+namespace detail {
+
+/// out[m] for the upsampled times t = start + m * down. Phase t % up is applied to in[t / up, t / up + taps).
+template<std::floating_point Float>
+auto polyphase_resample(
+    Float const* NEO_RESTRICT in,
+    Float const* NEO_RESTRICT phases,
+    std::size_t taps,
+    std::size_t up,
+    std::size_t down,
+    std::size_t start,
+    Float* NEO_RESTRICT out,
+    std::size_t size
+) noexcept -> void
+{
+    auto index       = start / up;
+    auto phase       = start % up;
+    auto const skip  = down / up;
+    auto const carry = down % up;
+
+    for (auto m{0zu}; m < size; ++m) {
+        out[m] = neo::detail::dot(phases + phase * taps, in + index, taps);
+
+        index += skip;
+        phase += carry;
+        if (phase >= up) {
+            phase -= up;
+            ++index;
+        }
+    }
+}
+
+/// Kaiser windowed sinc with the stopband starting at the lower nyquist, split into up phases of taps each.
+/// The taps of every phase are reversed, so they line up with the input in ascending order.
+template<std::floating_point Float>
+[[nodiscard]] auto make_polyphase_filter(std::size_t up, std::size_t down, std::size_t taps)
+    -> stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>
+{
+    static constexpr auto beta = 8.6;
+
+    auto const length = taps * up;
+    auto const center = length / 2zu;
+    auto const factor = static_cast<double>(std::max(up, down));
+
+    // Kaiser's estimate of the transition width in cycles per upsampled sample
+    auto const attenuation = beta / 0.1102 + 8.7;
+    auto const transition  = (attenuation - 7.95) / (14.36 * static_cast<double>(length));
+    auto const cutoff      = std::max(0.5 / factor - transition * 0.5, 0.25 / factor);
+    auto const window      = kaiser_window<double>{beta};
+
+    auto filter = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{up, taps};
+    for (auto j{0zu}; j < length; ++j) {
+        auto const x    = 2.0 * cutoff * (static_cast<double>(j) - static_cast<double>(center));
+        auto const sinc = x == 0.0 ? 1.0 : std::sin(std::numbers::pi * x) / (std::numbers::pi * x);
+        auto const gain = static_cast<double>(up) * 2.0 * cutoff;
+        filter(j % up, taps - 1zu - j / up) = static_cast<Float>(gain * sinc * window(j, center * 2zu + 1zu));
+    }
+    return filter;
+}
+
+}  // namespace detail
+
+/// Up & down factors to convert between integer sample rates, e.g. {160, 147} for 44.1 to 48 kHz.
+/// Throws std::invalid_argument if a rate is not a positive integer.
+/// \ingroup neo-convolution
+[[nodiscard]] inline auto resample_factors(double from, double to) -> std::pair<std::size_t, std::size_t>
+{
+    if (not(from >= 1.0 and to >= 1.0) or std::trunc(from) != from or std::trunc(to) != to) {
+        throw std::invalid_argument{"resample_factors: sample rates must be positive integers"};
+    }
+
+    auto const up   = static_cast<std::size_t>(to);
+    auto const down = static_cast<std::size_t>(from);
+    auto const gcd  = std::gcd(up, down);
+    return {up / gcd, down / gcd};
+}
+
+/// Streaming sample rate conversion by the rational factor up / down.
+///
+/// The anti-aliasing filter is a Kaiser windowed sinc at up times the input rate, split into
+/// up phases. Every output sample is a single dot product of one phase with the input history,
+/// so the cost per output is taps_per_phase() multiply-adds, independent of the factors.
+/// length is the filter length in samples of the lower of both rates, the transition band
+/// shrinks with it. The output is delayed by delay() input samples.
+///
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+struct polyphase_resampler
+{
+    using value_type = Float;
+    using size_type  = std::size_t;
+
+    /// Throws std::invalid_argument if a factor or the length is zero
+    polyphase_resampler(size_type up, size_type down, size_type length = 64);
+
+    [[nodiscard]] auto up() const noexcept -> size_type { return _up; }
+
+    [[nodiscard]] auto down() const noexcept -> size_type { return _down; }
+
+    [[nodiscard]] auto taps_per_phase() const noexcept -> size_type { return _phases.extent(1); }
+
+    /// up() x taps_per_phase(), the taps of every phase are reversed
+    [[nodiscard]] auto phases() const noexcept { return _phases.to_mdspan(); }
+
+    /// Group delay of the filter in input samples
+    [[nodiscard]] auto delay() const noexcept -> double
+    {
+        return static_cast<double>(taps_per_phase() * up() / 2zu) / static_cast<double>(up());
+    }
+
+    /// Number of samples the next call with input_size samples writes
+    [[nodiscard]] auto output_size(size_type input_size) const noexcept -> size_type;
+
+    auto reset() -> void;
+
+    /// Writes output_size(in.extent(0)) samples to the front of out & returns the count
+    template<in_vector_of<Float> InVec, out_vector_of<Float> OutVec>
+    auto operator()(InVec in, OutVec out) -> size_type;
+
+private:
+    static constexpr auto chunk_size = 256zu;
+
+    size_type _up;
+    size_type _down;
+    stdex::mdarray<Float, stdex::dextents<size_type, 2>> _phases;
+
+    // Upsampled time of the next output, relative to the first sample of the next chunk
+    size_type _time{0};
+
+    // History of taps_per_phase() - 1 samples, followed by the current chunk
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _buffer;
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _output;
+};
+
+template<std::floating_point Float>
+polyphase_resampler<Float>::polyphase_resampler(size_type up, size_type down, size_type length)
+{
+    if (up == 0 or down == 0 or length == 0) {
+        throw std::invalid_argument{"polyphase_resampler: factors & length must be positive"};
+    }
+
+    auto const gcd = std::gcd(up, down);
+    _up            = up / gcd;
+    _down          = down / gcd;
+
+    auto const taps = (length * std::max(_up, _down) + _up - 1zu) / _up;
+    _phases         = detail::make_polyphase_filter<Float>(_up, _down, taps);
+    _buffer         = stdex::mdarray<Float, stdex::dextents<size_type, 1>>{taps - 1zu + chunk_size};
+    _output         = stdex::mdarray<Float, stdex::dextents<size_type, 1>>{output_size(chunk_size)};
+}
+
+template<std::floating_point Float>
+auto polyphase_resampler<Float>::output_size(size_type input_size) const noexcept -> size_type
+{
+    auto const end = input_size * _up;
+    return _time < end ? (end - _time + _down - 1zu) / _down : 0zu;
+}
+
+template<std::floating_point Float>
+auto polyphase_resampler<Float>::reset() -> void
+{
+    fill(_buffer.to_mdspan(), Float(0));
+    _time = 0;
+}
+
+template<std::floating_point Float>
+template<in_vector_of<Float> InVec, out_vector_of<Float> OutVec>
+auto polyphase_resampler<Float>::operator()(InVec in, OutVec out) -> size_type
+{
+    assert(std::cmp_greater_equal(out.extent(0), output_size(in.extent(0))));
+
+    auto const taps    = taps_per_phase();
+    auto const history = taps - 1zu;
+    auto* const buffer = _buffer.data();
+
+    auto written = 0zu;
+    for (auto offset{0zu}; offset < in.extent(0); offset += chunk_size) {
+        auto const size = std::min(chunk_size, in.extent(0) - offset);
+        for (auto i{0zu}; i < size; ++i) {
+            buffer[history + i] = in[offset + i];
+        }
+
+        auto const count = output_size(size);
+        detail::polyphase_resample(buffer, _phases.data(), taps, _up, _down, _time, _output.data(), count);
+        for (auto i{0zu}; i < count; ++i) {
+            out[written + i] = _output(i);
+        }
+
+        written += count;
+        _time = _time + count * _down - size * _up;
+        std::copy(buffer + size, buffer + size + history, buffer);
+    }
+
+    return written;
+}
+
+/// Converts every row by the rational factor up / down, to ceil(size * up / down) samples.
+///
+/// Uses the same filter as polyphase_resampler, but compensates its delay. Only the kept
+/// outputs are computed, which beats filtering with an offline_convolver & decimating even
+/// for large downsampling factors (see extra/benchmark/src/resample.cpp).
+///
+/// \ingroup neo-convolution
+template<in_matrix InMat>
+    requires std::floating_point<value_type_t<InMat>>
+[[nodiscard]] auto resample(InMat signal, std::size_t up, std::size_t down, std::size_t length = 64)
+{
+    using Float = value_type_t<InMat>;
+
+    auto const resampler = polyphase_resampler<Float>{up, down, length};
+
+    auto const num_channels = signal.extent(0);
+    auto const size         = signal.extent(1);
+    auto const taps         = resampler.taps_per_phase();
+    auto const start        = taps * resampler.up() / 2zu;
+    auto const output_size  = (size * resampler.up() + resampler.down() - 1zu) / resampler.down();
+
+    auto output = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_channels, output_size};
+
+    // taps - 1 zeros of history in front, enough zeros behind to flush the delay
+    auto padded = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size + taps * 2zu};
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        for (auto i{0zu}; i < size; ++i) {
+            padded(taps - 1zu + i) = signal(ch, i);
+        }
+
+        auto const row = stdex::submdspan(output.to_mdspan(), ch, stdex::full_extent);
+        detail::polyphase_resample(
+            padded.data(),
+            resampler.phases().data_handle(),
+            taps,
+            resampler.up(),
+            resampler.down(),
+            start,
+            row.data_handle(),
+            output_size
+        );
+    }
+
+    return output;
+}
+
+}  // namespace neo::convolution
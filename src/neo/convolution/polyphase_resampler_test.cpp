@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: MIT
+
+#include "polyphase_resampler.hpp"
+
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+template<typename Float>
+auto make_sine(std::size_t size, double frequency, double sample_rate)
+{
+    auto sine = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{1zu, size};
+    for (auto i{0zu}; i < size; ++i) {
+        auto const t = static_cast<double>(i) / sample_rate;
+        sine(0, i)   = static_cast<Float>(std::sin(std::numbers::pi * 2.0 * frequency * t));
+    }
+    return sine;
+}
+
+}  // namespace
+
+TEST_CASE("neo/convolution: resample_factors")
+{
+    using neo::convolution::resample_factors;
+
+    REQUIRE(resample_factors(44'100.0, 48'000.0) == std::pair{160zu, 147zu});
+    REQUIRE(resample_factors(48'000.0, 44'100.0) == std::pair{147zu, 160zu});
+    REQUIRE(resample_factors(48'000.0, 96'000.0) == std::pair{2zu, 1zu});
+    REQUIRE(resample_factors(48'000.0, 48'000.0) == std::pair{1zu, 1zu});
+
+    REQUIRE_THROWS_AS(resample_factors(44'100.5, 48'000.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(resample_factors(0.0, 48'000.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(resample_factors(48'000.0, -1.0), std::invalid_argument);
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: polyphase_resampler", "", float, double)
+{
+    using Float = TestType;
+
+    auto const factors = GENERATE(
+        std::pair{1zu, 1zu},
+        std::pair{2zu, 1zu},
+        std::pair{1zu, 4zu},
+        std::pair{160zu, 147zu}
+    );
+    auto const block_size = GENERATE(as<std::size_t>{}, 1, 63, 512, 2000);
+    CAPTURE(factors.first, factors.second, block_size);
+
+    auto const signal = neo::generate_noise_signal<Float>(3000, Catch::getSeed());
+
+    // The whole signal at once is the reference for any block size
+    auto reference = neo::convolution::polyphase_resampler<Float>{factors.first, factors.second};
+    auto expected  = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{reference.output_size(3000)};
+    REQUIRE(reference(signal.to_mdspan(), expected.to_mdspan()) == expected.extent(0));
+    REQUIRE(expected.extent(0) == (3000zu * reference.up() + reference.down() - 1zu) / reference.down());
+
+    auto resampler = neo::convolution::polyphase_resampler<Float>{factors.first, factors.second};
+    auto output    = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{expected.extent(0)};
+    auto written   = 0zu;
+    for (auto i{0zu}; i < signal.extent(0); i += block_size) {
+        auto const block = stdex::submdspan(signal.to_mdspan(), std::tuple{i, std::min(i + block_size, 3000zu)});
+        auto const count = resampler.output_size(block.extent(0));
+        auto const out   = stdex::submdspan(output.to_mdspan(), std::tuple{written, written + count});
+        REQUIRE(resampler(block, out) == count);
+        written += count;
+    }
+
+    REQUIRE(written == expected.extent(0));
+    for (auto i{0zu}; i < written; ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(output(i), Catch::Matchers::WithinAbs(expected(i), 1e-5));
+    }
+
+    resampler.reset();
+    auto again = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{expected.extent(0)};
+    resampler(signal.to_mdspan(), again.to_mdspan());
+    for (auto i{0zu}; i < written; ++i) {
+        REQUIRE(again(i) == expected(i));
+    }
+
+    REQUIRE_THROWS_AS(neo::convolution::polyphase_resampler<Float>(0, 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(neo::convolution::polyphase_resampler<Float>(1, 0), std::invalid_argument);
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: resample", "", float, double)
+{
+    using Float = TestType;
+
+    auto const rates = GENERATE(
+        std::pair{44'100.0, 48'000.0},
+        std::pair{48'000.0, 44'100.0},
+        std::pair{48'000.0, 96'000.0},
+        std::pair{48'000.0, 192'000.0},
+        std::pair{96'000.0, 48'000.0},
+        std::pair{48'000.0, 6'000.0}
+    );
+    CAPTURE(rates.first, rates.second);
+
+    auto const [up, down] = neo::convolution::resample_factors(rates.first, rates.second);
+
+    SECTION("passband")
+    {
+        // The delay is compensated, the output matches the sine sampled at the new rate
+        auto const size   = 4800zu;
+        auto const input  = make_sine<Float>(size, 1000.0, rates.first);
+        auto const output = neo::convolution::resample(input.to_mdspan(), up, down);
+        REQUIRE(output.extent(0) == 1zu);
+        REQUIRE(output.extent(1) == (size * up + down - 1zu) / down);
+
+        auto const expected = make_sine<double>(output.extent(1), 1000.0, rates.second);
+        for (auto i{output.extent(1) / 4zu}; i < output.extent(1) * 3zu / 4zu; ++i) {
+            CAPTURE(i);
+            REQUIRE_THAT(output(0, i), Catch::Matchers::WithinAbs(expected(0, i), 1e-3));
+        }
+    }
+
+    SECTION("stopband")
+    {
+        // A tone just above the lower nyquist must not alias into the output
+        auto const nyquist = std::min(rates.first, rates.second) * 0.5;
+        if (rates.first > rates.second) {
+            auto const input  = make_sine<Float>(4800zu, nyquist * 1.05, rates.first);
+            auto const output = neo::convolution::resample(input.to_mdspan(), up, down);
+            for (auto i{output.extent(1) / 4zu}; i < output.extent(1) * 3zu / 4zu; ++i) {
+                CAPTURE(i);
+                REQUIRE_THAT(output(0, i), Catch::Matchers::WithinAbs(0.0, 1e-3));
+            }
+        }
+    }
+}
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/complex.hpp>
+#include <neo/convolution/dense_fdl.hpp>
+#include <neo/convolution/mixed_precision_filter.hpp>
+#include <neo/convolution/overlap_add.hpp>
+#include <neo/convolution/overlap_save.hpp>
+#include <neo/convolution/quantized_fdl.hpp>
+#include <neo/convolution/quantized_filter.hpp>
+#include <neo/convolution/uniform_partitioned_convolver.hpp>
+
+namespace neo::convolution {
+
+/// \ingroup neo-convolution
+template<complex Complex, quantized_value Quantized>
+using quantized_upols_convolver
+    = uniform_partitioned_convolver<overlap_save<Complex>, dense_fdl<Complex>, quantized_filter<Complex, Quantized>>;
+
+/// \ingroup neo-convolution
+template<complex Complex, quantized_value Quantized>
+using quantized_upola_convolver
+    = uniform_partitioned_convolver<overlap_add<Complex>, dense_fdl<Complex>, quantized_filter<Complex, Quantized>>;
+
+/// Filter and delay line are both quantized
+/// \ingroup neo-convolution
+template<complex Complex, quantized_value Quantized>
+using fully_quantized_upols_convolver = uniform_partitioned_convolver<
+    overlap_save<Complex>,
+    quantized_fdl<Complex, Quantized>,
+    quantized_filter<Complex, Quantized>>;
+
+/// \ingroup neo-convolution
+template<complex Complex>
+using mixed_precision_upols_convolver
+    = uniform_partitioned_convolver<overlap_save<Complex>, dense_fdl<Complex>, mixed_precision_filter<Complex>>;
+
+/// \ingroup neo-convolution
+template<complex Complex>
+using mixed_precision_upola_convolver
+    = uniform_partitioned_convolver<overlap_add<Complex>, dense_fdl<Complex>, mixed_precision_filter<Complex>>;
+
+}  // namespace neo::convolution
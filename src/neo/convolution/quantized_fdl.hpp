@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/convolution/quantized_span.hpp>
+
+namespace neo::convolution {
+
+/// Frequency-domain delay line storing each spectrum quantized with its own scale.
+///
+/// Rows are returned as quantized_span and are dequantized on the fly by the
+/// multiply-accumulate of quantized_filter.
+///
+/// \ingroup neo-convolution
+template<complex Complex, quantized_value Quantized>
+struct quantized_fdl
+{
+    using value_type     = Complex;
+    using quantized_type = Quantized;
+
+    quantized_fdl() = default;
+
+    explicit quantized_fdl(stdex::dextents<size_t, 2> extents)
+        : _fdl{extents.extent(0), extents.extent(1) * 2zu}
+        , _scales{extents.extent(0)}
+    {}
+
+    [[nodiscard]] auto operator[](std::integral auto index) const noexcept -> quantized_span<Quantized>
+    {
+        auto const row = stdex::submdspan(_fdl.to_mdspan(), index, stdex::full_extent);
+        return {row.data_handle(), _scales(index), row.extent(0) / 2zu};
+    }
+
+    auto insert(in_vector_of<Complex> auto input, std::integral auto index) noexcept -> void
+    {
+        auto const row = stdex::submdspan(_fdl.to_mdspan(), index, stdex::full_extent);
+        _scales(index) = detail::quantize_row(input, row.data_handle());
+    }
+
+private:
+    stdex::mdarray<Quantized, stdex::dextents<size_t, 2>> _fdl{};
+    stdex::mdarray<float, stdex::dextents<size_t, 1>> _scales{};
+};
+
+}  // namespace neo::convolution
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: MIT
+
+#include "quantized_fdl.hpp"
+
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+template<typename Quantized>
+constexpr auto tolerance = 0.0;
+
+template<>
+constexpr auto tolerance<std::int8_t> = 0.01;
+
+template<>
+constexpr auto tolerance<neo::q15> = 0.0001;
+
+#if defined(NEO_HAS_BUILTIN_FLOAT16)
+template<>
+constexpr auto tolerance<_Float16> = 0.001;
+#endif
+
+template<typename Quantized>
+auto test_quantized_fdl() -> void
+{
+    using Complex = std::complex<float>;
+    using Fdl     = neo::convolution::quantized_fdl<Complex, Quantized>;
+
+    STATIC_REQUIRE(std::same_as<typename Fdl::value_type, Complex>);
+    STATIC_REQUIRE(std::same_as<typename Fdl::quantized_type, Quantized>);
+
+    auto const num_bins = GENERATE(as<std::size_t>{}, 1, 3, 4, 17, 129);
+    CAPTURE(num_bins);
+
+    // Scale must not be limited to [-1, 1]
+    auto input = neo::generate_noise_signal<Complex>(num_bins, Catch::getSeed());
+    for (auto i{0zu}; i < num_bins; ++i) {
+        input(i) *= 4.0F;
+    }
+
+    auto fdl = Fdl{stdex::dextents<size_t, 2>{3, num_bins}};
+    fdl.insert(input.to_mdspan(), 1);
+
+    auto const row = fdl[1];
+    REQUIRE(row.extent(0) == num_bins);
+    for (auto i{0zu}; i < num_bins; ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(row.real(i), Catch::Matchers::WithinAbs(input(i).real(), 4.0 * tolerance<Quantized>));
+        REQUIRE_THAT(row.imag(i), Catch::Matchers::WithinAbs(input(i).imag(), 4.0 * tolerance<Quantized>));
+    }
+
+    auto const empty = fdl[0];
+    REQUIRE(empty.scale == 0.0F);
+    REQUIRE(empty.real(0) == 0.0F);
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/convolution: quantized_fdl", "", std::int8_t, neo::q15) { test_quantized_fdl<TestType>(); }
+
+#if defined(NEO_HAS_BUILTIN_FLOAT16)
+TEMPLATE_TEST_CASE("neo/convolution: quantized_fdl", "", _Float16) { test_quantized_fdl<TestType>(); }
+#endif
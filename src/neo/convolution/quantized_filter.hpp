@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/convolution/quantized_span.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#include <cassert>
+
+namespace neo::convolution {
+
+/// Frequency-domain filter storing each partition quantized with its own scale.
+///
+/// Supports std::int8_t, neo::q15 and _Float16 (if available) storage. The
+/// multiply-accumulate converts both operands to float in SIMD registers, so
+/// the filter stays compact in memory. Works with dense_fdl and quantized_fdl.
+///
+/// \ingroup neo-convolution
+template<complex Complex, quantized_value Quantized>
+    requires std::same_as<value_type_t<Complex>, float>
+struct quantized_filter
+{
+    using value_type       = Complex;
+    using quantized_type   = Quantized;
+    using accumulator_type = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>;
+
+    quantized_filter() = default;
+
+    auto filter(in_matrix_of<Complex> auto filter) -> void
+    {
+        _filter = stdex::mdarray<Quantized, stdex::dextents<size_t, 2>>{filter.extent(0), filter.extent(1) * 2zu};
+        _scales = stdex::mdarray<float, stdex::dextents<size_t, 1>>{filter.extent(0)};
+
+        for (auto i{0zu}; i < filter.extent(0); ++i) {
+            auto const partition = stdex::submdspan(filter, i, stdex::full_extent);
+            auto const row       = stdex::submdspan(_filter.to_mdspan(), i, stdex::full_extent);
+            _scales(i)           = detail::quantize_row(partition, row.data_handle());
+        }
+    }
+
+    [[nodiscard]] auto operator[](std::integral auto index) const noexcept -> quantized_span<Quantized>
+    {
+        auto const row = stdex::submdspan(_filter.to_mdspan(), index, stdex::full_extent);
+        return {row.data_handle(), _scales(index), row.extent(0) / 2zu};
+    }
+
+    template<typename FdlRow, std::integral Index, inout_vector_of<Complex> Accumulator>
+    auto operator()(FdlRow fdl, Index filter_index, Accumulator accumulator) -> void
+    {
+        assert(accumulator.extent(0) < 2 or accumulator.stride(0) == 1);
+        auto const out = reinterpret_cast<float*>(accumulator.data_handle());
+        detail::quantized_multiply_add(detail::as_quantized_span(fdl), (*this)[filter_index], out);
+    }
+
+private:
+    stdex::mdarray<Quantized, stdex::dextents<size_t, 2>> _filter;
+    stdex::mdarray<float, stdex::dextents<size_t, 1>> _scales;
+};
+
+}  // namespace neo::convolution
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: MIT
+
+#include "quantized_filter.hpp"
+
+#include <neo/convolution/dense_convolver.hpp>
+#include <neo/convolution/dense_filter.hpp>
+#include <neo/convolution/quantized_convolver.hpp>
+#include <neo/convolution/quantized_fdl.hpp>
+#include <neo/convolution/uniform_partition.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+namespace {
+
+// Maximum error relative to the largest component of a row
+template<typename Quantized>
+constexpr auto tolerance = 0.0;
+
+template<>
+constexpr auto tolerance<std::int8_t> = 0.02;
+
+template<>
+constexpr auto tolerance<neo::q15> = 0.0002;
+
+#if defined(NEO_HAS_BUILTIN_FLOAT16)
+template<>
+constexpr auto tolerance<_Float16> = 0.002;
+#endif
+
+// Error energy relative to the signal energy in dB
+[[nodiscard]] auto error_db(auto const& expected, auto const& actual) -> double
+{
+    auto signal = 0.0;
+    auto error  = 0.0;
+    for (auto i{0zu}; i < expected.extent(0); ++i) {
+        signal += static_cast<double>(expected(i) * expected(i));
+        error += static_cast<double>((expected(i) - actual(i)) * (expected(i) - actual(i)));
+    }
+    return 10.0 * std::log10(error / signal);
+}
+
+template<typename Quantized>
+auto test_quantized_filter() -> void
+{
+    using Complex   = std::complex<float>;
+    using Filter    = neo::convolution::quantized_filter<Complex, Quantized>;
+    using Fdl       = neo::convolution::quantized_fdl<Complex, Quantized>;
+
+    STATIC_REQUIRE(std::same_as<typename Filter::value_type, Complex>);
+    STATIC_REQUIRE(std::same_as<typename Filter::quantized_type, Quantized>);
+
+    auto const num_bins = GENERATE(as<std::size_t>{}, 1, 3, 4, 17, 129);
+    CAPTURE(num_bins);
+
+    auto const coefficients = neo::generate_noise_signal<Complex>(num_bins * 2zu, Catch::getSeed());
+    auto const matrix       = stdex::mdspan{coefficients.data(), stdex::extents{2zu, num_bins}};
+    auto const spectrum     = neo::generate_noise_signal<Complex>(num_bins, Catch::getSeed() + 1U);
+
+    auto dense = neo::convolution::dense_filter<Complex>{};
+    dense.filter(matrix);
+
+    auto filter = Filter{};
+    filter.filter(matrix);
+
+    auto fdl = Fdl{matrix.extents()};
+    fdl.insert(spectrum.to_mdspan(), 0);
+
+    auto expected = typename Filter::accumulator_type{num_bins};
+    auto dequant  = typename Filter::accumulator_type{num_bins};
+    auto quant    = typename Filter::accumulator_type{num_bins};
+    for (auto i{0zu}; i < matrix.extent(0); ++i) {
+        dense(spectrum.to_mdspan(), i, expected.to_mdspan());
+        filter(spectrum.to_mdspan(), i, dequant.to_mdspan());
+        filter(fdl[0], i, quant.to_mdspan());
+    }
+
+    for (auto i{0zu}; i < num_bins; ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(dequant(i).real(), Catch::Matchers::WithinAbs(expected(i).real(), 4.0 * tolerance<Quantized>));
+        REQUIRE_THAT(dequant(i).imag(), Catch::Matchers::WithinAbs(expected(i).imag(), 4.0 * tolerance<Quantized>));
+        REQUIRE_THAT(quant(i).real(), Catch::Matchers::WithinAbs(expected(i).real(), 8.0 * tolerance<Quantized>));
+        REQUIRE_THAT(quant(i).imag(), Catch::Matchers::WithinAbs(expected(i).imag(), 8.0 * tolerance<Quantized>));
+    }
+}
+
+template<typename Quantized>
+auto test_quantized_convolver() -> void
+{
+    using Complex = std::complex<float>;
+
+    static constexpr auto max_error_db = std::same_as<Quantized, neo::q15> ? -60.0 : -30.0;
+
+    auto const block_size = GENERATE(as<std::size_t>{}, 128, 256);
+    CAPTURE(block_size);
+
+    auto const impulse = neo::generate_noise_signal<float>(block_size * 3zu, Catch::getSeed());
+    auto const matrix  = stdex::mdspan{impulse.data(), stdex::extents{1zu, impulse.extent(0)}};
+    auto const filter  = neo::convolution::uniform_partition(matrix, block_size);
+    auto const channel = stdex::submdspan(filter.to_mdspan(), 0, stdex::full_extent, stdex::full_extent);
+
+    auto const signal = neo::generate_noise_signal<float>(block_size * 8zu, Catch::getSeed() + 1U);
+    auto expected     = signal;
+    auto quantized    = signal;
+    auto fully        = signal;
+
+    auto dense_convolver     = neo::convolution::upols_convolver<Complex>{};
+    auto quantized_convolver = neo::convolution::quantized_upols_convolver<Complex, Quantized>{};
+    auto fully_convolver     = neo::convolution::fully_quantized_upols_convolver<Complex, Quantized>{};
+    dense_convolver.filter(channel);
+    quantized_convolver.filter(channel);
+    fully_convolver.filter(channel);
+
+    for (std::size_t i{0}; i < signal.extent(0); i += block_size) {
+        dense_convolver(stdex::submdspan(expected.to_mdspan(), std::tuple{i, i + block_size}));
+        quantized_convolver(stdex::submdspan(quantized.to_mdspan(), std::tuple{i, i + block_size}));
+        fully_convolver(stdex::submdspan(fully.to_mdspan(), std::tuple{i, i + block_size}));
+    }
+
+    REQUIRE(error_db(expected, quantized) < max_error_db);
+    REQUIRE(error_db(expected, fully) < max_error_db);
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/convolution: quantized_filter", "", std::int8_t, neo::q15)
+{
+    test_quantized_filter<TestType>();
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: quantized_upols_convolver", "", std::int8_t, neo::q15)
+{
+    test_quantized_convolver<TestType>();
+}
+
+#if defined(NEO_HAS_BUILTIN_FLOAT16)
+TEMPLATE_TEST_CASE("neo/convolution: quantized_filter", "", _Float16) { test_quantized_filter<TestType>(); }
+
+TEMPLATE_TEST_CASE("neo/convolution: quantized_upols_convolver", "", _Float16)
+{
+    test_quantized_convolver<TestType>();
+}
+#endif
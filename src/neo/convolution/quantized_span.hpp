@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fixed_point/fixed_point.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#if defined(NEO_HAS_ISA_AVX2)
+    #include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace neo::convolution {
+
+namespace detail {
+
+template<typename T>
+struct quantization;
+
+template<std::floating_point Float>
+struct quantization<Float>
+{
+    static constexpr auto range = 1.0F;
+
+    [[nodiscard]] static auto quantize(float normalized) noexcept -> Float { return static_cast<Float>(normalized); }
+
+    [[nodiscard]] static auto dequantize(Float val) noexcept -> float { return static_cast<float>(val); }
+};
+
+template<>
+struct quantization<std::int8_t>
+{
+    static constexpr auto range = 127.0F;
+
+    [[nodiscard]] static auto quantize(float normalized) noexcept -> std::int8_t
+    {
+        return static_cast<std::int8_t>(std::lround(std::clamp(normalized, -1.0F, 1.0F) * range));
+    }
+
+    [[nodiscard]] static auto dequantize(std::int8_t val) noexcept -> float { return static_cast<float>(val); }
+};
+
+template<>
+struct quantization<q15>
+{
+    static constexpr auto range = q15::scale;
+
+    [[nodiscard]] static auto quantize(float normalized) noexcept -> q15 { return q15{normalized}; }
+
+    [[nodiscard]] static auto dequantize(q15 val) noexcept -> float { return static_cast<float>(val.value()); }
+};
+
+#if defined(NEO_HAS_BUILTIN_FLOAT16)
+template<>
+struct quantization<_Float16>
+{
+    static constexpr auto range = 1.0F;
+
+    [[nodiscard]] static auto quantize(float normalized) noexcept -> _Float16
+    {
+        return static_cast<_Float16>(normalized);
+    }
+
+    [[nodiscard]] static auto dequantize(_Float16 val) noexcept -> float { return static_cast<float>(val); }
+};
+#endif
+
+}  // namespace detail
+
+/// Storage types supported by quantized_fdl & quantized_filter
+/// \ingroup neo-convolution
+template<typename T>
+concept quantized_value = requires(T val) {
+    { detail::quantization<T>::range } -> std::convertible_to<float>;
+    { detail::quantization<T>::dequantize(val) } -> std::same_as<float>;
+};
+
+/// Row of interleaved (real, imag) quantized values sharing one scale factor
+/// \details Element i dequantizes to {data[2i], data[2i+1]} * scale
+/// \ingroup neo-convolution
+template<quantized_value T>
+struct quantized_span
+{
+    using value_type = T;
+
+    T const* data{nullptr};
+    float scale{1.0F};
+    std::size_t size{0};
+
+    [[nodiscard]] auto extent(std::size_t /*r*/) const noexcept -> std::size_t { return size; }
+
+    [[nodiscard]] auto real(std::size_t i) const noexcept -> float
+    {
+        return detail::quantization<T>::dequantize(data[i * 2zu]) * scale;
+    }
+
+    [[nodiscard]] auto imag(std::size_t i) const noexcept -> float
+    {
+        return detail::quantization<T>::dequantize(data[i * 2zu + 1zu]) * scale;
+    }
+};
+
+namespace detail {
+
+/// Quantizes a complex row into interleaved storage, returns the scale factor
+template<quantized_value T>
+auto quantize_row(in_vector auto input, T* output) noexcept -> float
+{
+    auto max = 0.0F;
+    for (auto i{0zu}; i < input.extent(0); ++i) {
+        auto const re = std::abs(static_cast<float>(input[i].real()));
+        auto const im = std::abs(static_cast<float>(input[i].imag()));
+        max           = std::max({max, re, im});
+    }
+
+    auto const inv = max > 0.0F ? 1.0F / max : 0.0F;
+    for (auto i{0zu}; i < input.extent(0); ++i) {
+        output[i * 2zu]       = quantization<T>::quantize(static_cast<float>(input[i].real()) * inv);
+        output[i * 2zu + 1zu] = quantization<T>::quantize(static_cast<float>(input[i].imag()) * inv);
+    }
+    return max / quantization<T>::range;
+}
+
+/// Dense single precision row, seen as a quantized_span with a scale of one
+template<in_vector InVec>
+    requires std::same_as<value_type_t<value_type_t<InVec>>, float>
+[[nodiscard]] auto as_quantized_span(InVec row) noexcept -> quantized_span<float>
+{
+    static_assert(sizeof(value_type_t<InVec>) == sizeof(float) * 2zu);
+    assert(row.extent(0) < 2 or row.stride(0) == 1);
+    return {reinterpret_cast<float const*>(row.data_handle()), 1.0F, row.extent(0)};
+}
+
+template<quantized_value T>
+[[nodiscard]] auto as_quantized_span(quantized_span<T> row) noexcept -> quantized_span<T>
+{
+    return row;
+}
+
+#if defined(NEO_HAS_ISA_AVX2)
+// Loads 8 values (4 complex) and converts them to float
+[[nodiscard]] NEO_ALWAYS_INLINE auto load_dequantized(float const* ptr) noexcept -> __m256
+{
+    return _mm256_loadu_ps(ptr);
+}
+
+[[nodiscard]] NEO_ALWAYS_INLINE auto load_dequantized(std::int8_t const* ptr) noexcept -> __m256
+{
+    auto const bytes = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(ptr));
+    return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(bytes));
+}
+
+[[nodiscard]] NEO_ALWAYS_INLINE auto load_dequantized(q15 const* ptr) noexcept -> __m256
+{
+    static_assert(sizeof(q15) == sizeof(std::int16_t));
+    auto const words = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr));
+    return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(words));
+}
+
+    #if defined(NEO_HAS_BUILTIN_FLOAT16) and defined(NEO_HAS_ISA_F16C)
+[[nodiscard]] NEO_ALWAYS_INLINE auto load_dequantized(_Float16 const* ptr) noexcept -> __m256
+{
+    return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr)));
+}
+    #endif
+
+template<typename T>
+concept avx2_dequantizable = requires(T const* ptr) { load_dequantized(ptr); };
+
+// (a.re*b.re - a.im*b.im, a.im*b.re + a.re*b.im) on 4 interleaved complex numbers
+[[nodiscard]] NEO_ALWAYS_INLINE auto complex_multiply(__m256 a, __m256 b) noexcept -> __m256
+{
+    auto const b_real = _mm256_moveldup_ps(b);
+    auto const b_imag = _mm256_movehdup_ps(b);
+    auto const a_swap = _mm256_permute_ps(a, 0b1011'0001);
+    return _mm256_addsub_ps(_mm256_mul_ps(a, b_real), _mm256_mul_ps(a_swap, b_imag));
+}
+#endif
+
+/// out[i] += lhs[i] * rhs[i], both rows are dequantized in registers
+template<quantized_value L, quantized_value R>
+auto quantized_multiply_add(quantized_span<L> lhs, quantized_span<R> rhs, float* NEO_RESTRICT out) noexcept -> void
+{
+    assert(lhs.size == rhs.size);
+
+    // Scales factor out of the complex product: (sl * l) * (sr * r) = (sl * sr) * (l * r)
+    auto const scale = lhs.scale * rhs.scale;
+    auto i           = 0zu;
+
+#if defined(NEO_HAS_ISA_AVX2)
+    if constexpr (avx2_dequantizable<L> and avx2_dequantizable<R>) {
+        auto const factor = _mm256_set1_ps(scale);
+        for (; i + 4zu <= lhs.size; i += 4zu) {
+            auto const a   = load_dequantized(lhs.data + i * 2zu);
+            auto const b   = load_dequantized(rhs.data + i * 2zu);
+            auto const acc = _mm256_loadu_ps(out + i * 2zu);
+            _mm256_storeu_ps(out + i * 2zu, _mm256_add_ps(acc, _mm256_mul_ps(complex_multiply(a, b), factor)));
+        }
+    }
+#endif
+
+    for (; i < lhs.size; ++i) {
+        auto const a_re = quantization<L>::dequantize(lhs.data[i * 2zu]);
+        auto const a_im = quantization<L>::dequantize(lhs.data[i * 2zu + 1zu]);
+        auto const b_re = quantization<R>::dequantize(rhs.data[i * 2zu]);
+        auto const b_im = quantization<R>::dequantize(rhs.data[i * 2zu + 1zu]);
+        out[i * 2zu] += (a_re * b_re - a_im * b_im) * scale;
+        out[i * 2zu + 1zu] += (a_im * b_re + a_re * b_im) * scale;
+    }
+}
+
+}  // namespace detail
+
+}  // namespace neo::convolution
@@ -6,6 +6,7 @@
 #include <neo/convolution/dense_fdl.hpp>
 #include <neo/convolution/overlap_add.hpp>
 #include <neo/convolution/overlap_save.hpp>
+#include <neo/convolution/sparse_fdl.hpp>
 #include <neo/convolution/sparse_filter.hpp>
 #include <neo/convolution/uniform_partitioned_convolver.hpp>
 
@@ -21,4 +22,14 @@ template<complex Complex>
 using sparse_upola_convolver
     = uniform_partitioned_convolver<overlap_add<Complex>, dense_fdl<Complex>, sparse_filter<Complex>>;
 
+/// \ingroup neo-convolution
+template<complex Complex>
+using pruned_sparse_upols_convolver
+    = uniform_partitioned_convolver<overlap_save<Complex>, sparse_fdl<Complex>, pruned_sparse_filter<Complex>>;
+
+/// \ingroup neo-convolution
+template<complex Complex>
+using pruned_sparse_upola_convolver
+    = uniform_partitioned_convolver<overlap_add<Complex>, sparse_fdl<Complex>, pruned_sparse_filter<Complex>>;
+
 }  // namespace neo::convolution
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/complex/complex.hpp>
+#include <neo/container/mdspan.hpp>
+
+#include <cassert>
+#include <utility>
+
+namespace neo::convolution {
+
+/// Frequency-domain delay line that only stores a subset of bins.
+///
+/// Each inserted spectrum is gathered down to the given bins, so rows are
+/// compact and line up with the columns of a pruned_sparse_filter.
+///
+/// \ingroup neo-convolution
+template<complex Complex>
+struct sparse_fdl
+{
+    using value_type = Complex;
+
+    sparse_fdl() = default;
+
+    sparse_fdl(stdex::dextents<size_t, 2> extents, in_vector_of<size_t> auto bins)
+        : _bins{bins.extent(0)}
+        , _fdl{extents.extent(0), bins.extent(0)}
+    {
+        for (auto i{0zu}; i < bins.extent(0); ++i) {
+            assert(std::cmp_less(bins[i], extents.extent(1)));
+            _bins(i) = bins[i];
+        }
+    }
+
+    [[nodiscard]] auto bins() const noexcept -> in_vector_of<size_t> auto { return _bins.to_mdspan(); }
+
+    [[nodiscard]] auto operator[](std::integral auto index) const noexcept -> in_vector_of<Complex> auto
+    {
+        return stdex::submdspan(_fdl.to_mdspan(), index, stdex::full_extent);
+    }
+
+    auto insert(in_vector_of<Complex> auto input, std::integral auto index) noexcept -> void
+    {
+        auto const row = stdex::submdspan(_fdl.to_mdspan(), index, stdex::full_extent);
+        for (auto i{0zu}; i < _bins.extent(0); ++i) {
+            row[i] = input[_bins(i)];
+        }
+    }
+
+private:
+    stdex::mdarray<size_t, stdex::dextents<size_t, 1>> _bins{};
+    stdex::mdarray<Complex, stdex::dextents<size_t, 2>> _fdl{};
+};
+
+}  // namespace neo::convolution
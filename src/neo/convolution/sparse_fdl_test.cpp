@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+
+#include "sparse_fdl.hpp"
+
+#include <neo/complex/scalar_complex.hpp>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <array>
+
+TEMPLATE_TEST_CASE(
+    "neo/convolution: sparse_fdl",
+    "",
+    std::complex<float>,
+    std::complex<double>,
+    neo::complex64,
+    neo::complex128
+)
+{
+    using Complex = TestType;
+    using Float   = typename Complex::value_type;
+    using Fdl     = neo::convolution::sparse_fdl<Complex>;
+    STATIC_REQUIRE(std::same_as<typename Fdl::value_type, Complex>);
+
+    auto bins = std::array<std::size_t, 3>{1, 2, 6};
+    auto fdl  = Fdl{stdex::dextents<std::size_t, 2>{4, 8}, stdex::mdspan{bins.data(), stdex::extents{bins.size()}}};
+    REQUIRE(fdl.bins().extent(0) == 3);
+    REQUIRE(fdl[0].extent(0) == 3);
+
+    auto spectrum = std::array<Complex, 8>{};
+    for (auto i{0zu}; i < spectrum.size(); ++i) {
+        spectrum[i] = Complex{static_cast<Float>(i)};
+    }
+
+    fdl.insert(stdex::mdspan{spectrum.data(), stdex::extents{spectrum.size()}}, 2);
+    REQUIRE(fdl[2][0].real() == Float(1));
+    REQUIRE(fdl[2][1].real() == Float(2));
+    REQUIRE(fdl[2][2].real() == Float(6));
+    REQUIRE(fdl[0][0].real() == Float(0));
+}
@@ -4,19 +4,22 @@
 
 #include <neo/algorithm/multiply_add.hpp>
 #include <neo/complex.hpp>
+#include <neo/container/block_sparse_matrix.hpp>
 #include <neo/container/csr_matrix.hpp>
 #include <neo/container/mdspan.hpp>
 
+#include <algorithm>
 #include <concepts>
+#include <vector>
 
 namespace neo::convolution {
 
 /// \ingroup neo-convolution
-template<complex Complex>
+template<complex Complex, typename Storage = block_sparse_matrix<Complex>>
 struct sparse_filter
 {
     using value_type       = Complex;
-    using storage_type     = csr_matrix<Complex>;
+    using storage_type     = Storage;
     using index_type       = typename storage_type::index_type;
     using accumulator_type = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>;
 
@@ -24,7 +27,7 @@ struct sparse_filter
 
     auto filter(in_matrix_of<Complex> auto input, auto sparsity) -> void
     {
-        _filter = csr_matrix<Complex>{input, sparsity};
+        _filter = storage_type{input, sparsity};
     }
 
     template<in_vector_of<Complex> FdlRow, std::integral Index, inout_vector_of<Complex> Accumulator>
@@ -34,7 +37,68 @@ struct sparse_filter
     }
 
 private:
-    csr_matrix<Complex> _filter;
+    storage_type _filter;
+};
+
+/// Sparse filter with all unused bins removed.
+///
+/// Only the union of bins used by any partition is kept, so the filter
+/// columns are compact and match the rows of a sparse_fdl.
+///
+/// \ingroup neo-convolution
+template<complex Complex, typename Storage = block_sparse_matrix<Complex>>
+struct pruned_sparse_filter
+{
+    using value_type       = Complex;
+    using storage_type     = Storage;
+    using index_type       = typename storage_type::index_type;
+    using accumulator_type = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>;
+
+    pruned_sparse_filter() = default;
+
+    auto filter(in_matrix_of<Complex> auto input, auto sparsity) -> void
+    {
+        auto used = std::vector<bool>(input.extent(1), false);
+        for (auto row{0zu}; row < input.extent(0); ++row) {
+            for (auto col{0zu}; col < input.extent(1); ++col) {
+                if (sparsity(row, col, input(row, col))) {
+                    used[col] = true;
+                }
+            }
+        }
+
+        auto const num_bins = static_cast<size_t>(std::count(used.begin(), used.end(), true));
+        _bins               = stdex::mdarray<size_t, stdex::dextents<size_t, 1>>{num_bins};
+        for (auto col{0zu}, bin{0zu}; col < input.extent(1); ++col) {
+            if (used[col]) {
+                _bins(bin++) = col;
+            }
+        }
+
+        auto compact = stdex::mdarray<Complex, stdex::dextents<size_t, 2>>{input.extent(0), num_bins};
+        for (auto row{0zu}; row < input.extent(0); ++row) {
+            for (auto bin{0zu}; bin < num_bins; ++bin) {
+                compact(row, bin) = input(row, _bins(bin));
+            }
+        }
+
+        _filter = storage_type{compact.to_mdspan(), [this, &sparsity](auto row, auto bin, auto const& value) {
+                                   return sparsity(row, _bins(bin), value);
+                               }};
+    }
+
+    /// Sorted list of the bins used by at least one partition
+    [[nodiscard]] auto bins() const noexcept -> in_vector_of<size_t> auto { return _bins.to_mdspan(); }
+
+    template<in_vector_of<Complex> FdlRow, std::integral Index, inout_vector_of<Complex> Accumulator>
+    auto operator()(FdlRow fdl, Index filter_index, Accumulator accumulator) -> void
+    {
+        multiply_add(fdl, _filter, static_cast<index_type>(filter_index), accumulator, accumulator);
+    }
+
+private:
+    stdex::mdarray<size_t, stdex::dextents<size_t, 1>> _bins{};
+    storage_type _filter;
 };
 
 }  // namespace neo::convolution
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/container/mdspan.hpp>
+#include <neo/fft/rfftfreq.hpp>
+#include <neo/math/a_weighting.hpp>
+#include <neo/math/abs.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace neo::convolution {
+
+/// Keep/drop decision for every bin of a uniformly partitioned filter.
+///
+/// Can be passed as the sparsity predicate of sparse_filter::filter(). Also reports
+/// the achieved sparsity and the expected error: The energy of all dropped bins
+/// relative to the total filter energy, which equals the relative error power
+/// of the output for a white input signal.
+///
+/// \ingroup neo-convolution
+struct sparsity_mask
+{
+    sparsity_mask() = default;
+
+    /// \p keep is called as keep(partition, bin) -> bool
+    template<in_matrix InMat, typename Keep>
+    sparsity_mask(InMat filter, Keep keep);
+
+    [[nodiscard]] auto operator()(std::size_t row, std::size_t col, auto const& /*value*/) const noexcept -> bool
+    {
+        return _mask(row, col) != 0;
+    }
+
+    [[nodiscard]] auto extents() const noexcept -> stdex::dextents<std::size_t, 2> { return _mask.extents(); }
+
+    /// Fraction of removed bins in [0, 1]
+    [[nodiscard]] auto sparsity() const noexcept -> double { return _sparsity; }
+
+    /// Removed energy relative to the total filter energy in [0, 1]
+    [[nodiscard]] auto error() const noexcept -> double { return _error; }
+
+    /// error() in dB
+    [[nodiscard]] auto error_db() const noexcept -> double
+    {
+        return _error > 0.0 ? 10.0 * std::log10(_error) : -std::numeric_limits<double>::infinity();
+    }
+
+private:
+    stdex::mdarray<std::uint8_t, stdex::dextents<std::size_t, 2>> _mask{};
+    double _sparsity{0.0};
+    double _error{0.0};
+};
+
+namespace detail {
+
+[[nodiscard]] auto bin_power(auto const& value) -> double
+{
+    auto const amplitude = static_cast<double>(math::abs(value));
+    return amplitude * amplitude;
+}
+
+/// DC and nyquist appear once in the full spectrum, all other bins twice
+[[nodiscard]] inline auto bin_energy_weight(std::size_t col, std::size_t num_bins) noexcept -> double
+{
+    return (col == 0 or col + 1 == num_bins) ? 1.0 : 2.0;
+}
+
+[[nodiscard]] auto max_bin_power(in_matrix auto filter) -> double
+{
+    auto max = 0.0;
+    for (auto row{0zu}; row < filter.extent(0); ++row) {
+        for (auto col{0zu}; col < filter.extent(1); ++col) {
+            max = std::max(max, bin_power(filter(row, col)));
+        }
+    }
+    return max;
+}
+
+[[nodiscard]] inline auto db_to_power(double db) noexcept -> double { return std::pow(10.0, db / 10.0); }
+
+/// Keeps the num_keep bins with the largest weighted energy, sorted over all partitions
+template<in_matrix InMat>
+[[nodiscard]] auto keep_largest(InMat filter, std::size_t num_keep) -> sparsity_mask
+{
+    auto const rows  = filter.extent(0);
+    auto const cols  = filter.extent(1);
+    auto const total = rows * cols;
+
+    auto order = std::vector<std::size_t>(total);
+    std::iota(order.begin(), order.end(), 0zu);
+
+    auto const power = [filter, cols](std::size_t i) { return bin_power(filter(i / cols, i % cols)); };
+    auto const first = order.begin();
+    auto const nth   = std::next(first, static_cast<std::ptrdiff_t>(std::min(num_keep, total)));
+    std::nth_element(first, nth, order.end(), [&](auto l, auto r) { return power(l) > power(r); });
+
+    auto keep = std::vector<std::uint8_t>(total, 0);
+    std::for_each(first, nth, [&](auto i) { keep[i] = 1; });
+    return sparsity_mask{filter, [&keep, cols](auto row, auto col) { return keep[row * cols + col] != 0; }};
+}
+
+}  // namespace detail
+
+template<in_matrix InMat, typename Keep>
+sparsity_mask::sparsity_mask(InMat filter, Keep keep) : _mask{filter.extent(0), filter.extent(1)}
+{
+    auto const rows = filter.extent(0);
+    auto const cols = filter.extent(1);
+
+    auto dropped        = 0zu;
+    auto dropped_energy = 0.0;
+    auto total_energy   = 0.0;
+
+    for (auto row{0zu}; row < rows; ++row) {
+        for (auto col{0zu}; col < cols; ++col) {
+            auto const energy = detail::bin_power(filter(row, col)) * detail::bin_energy_weight(col, cols);
+            auto const kept   = static_cast<bool>(keep(row, col));
+
+            _mask(row, col) = kept ? 1 : 0;
+            total_energy += energy;
+            if (not kept) {
+                dropped += 1;
+                dropped_energy += energy;
+            }
+        }
+    }
+
+    _sparsity = rows * cols > 0 ? static_cast<double>(dropped) / static_cast<double>(rows * cols) : 0.0;
+    _error    = total_energy > 0.0 ? dropped_energy / total_energy : 0.0;
+}
+
+/// Keeps all bins with a magnitude above the absolute threshold
+/// \ingroup neo-convolution
+template<in_matrix InMat>
+[[nodiscard]] auto threshold_sparsity(InMat filter, double threshold_db) -> sparsity_mask
+{
+    auto const limit = detail::db_to_power(threshold_db);
+    return sparsity_mask{filter, [=](auto row, auto col) { return detail::bin_power(filter(row, col)) > limit; }};
+}
+
+/// Keeps all bins with a magnitude above the threshold, relative to the loudest bin
+/// \ingroup neo-convolution
+template<in_matrix InMat>
+[[nodiscard]] auto relative_threshold_sparsity(InMat filter, double threshold_db) -> sparsity_mask
+{
+    return threshold_sparsity(filter, threshold_db + 10.0 * std::log10(detail::max_bin_power(filter)));
+}
+
+/// Relative threshold with a per-bin weighting in dB added to each bin's level
+/// \ingroup neo-convolution
+template<in_matrix InMat, in_vector Weights>
+[[nodiscard]] auto weighted_threshold_sparsity(InMat filter, double threshold_db, Weights weights_db)
+    -> sparsity_mask
+{
+    assert(weights_db.extent(0) == filter.extent(1));
+
+    auto const reference = detail::max_bin_power(filter);
+    auto limits          = std::vector<double>(filter.extent(1));
+    for (auto col{0zu}; col < limits.size(); ++col) {
+        limits[col] = reference * detail::db_to_power(threshold_db - static_cast<double>(weights_db[col]));
+    }
+
+    return sparsity_mask{filter, [&](auto row, auto col) { return detail::bin_power(filter(row, col)) > limits[col]; }};
+}
+
+/// Relative threshold on the A-weighted level of each bin
+/// \details The lowest \p low_bins_to_keep bins are always kept. DC uses the weight of the first bin.
+/// \ingroup neo-convolution
+template<in_matrix InMat>
+[[nodiscard]] auto a_weighted_threshold_sparsity(
+    InMat filter,
+    double threshold_db,
+    double sample_rate,
+    std::size_t low_bins_to_keep = 0
+) -> sparsity_mask
+{
+    auto const num_bins       = filter.extent(1);
+    auto const transform_size = std::max(num_bins - 1zu, 1zu) * 2zu;
+
+    auto weights = std::vector<double>(num_bins);
+    for (auto col{0zu}; col < num_bins; ++col) {
+        if (col < low_bins_to_keep) {
+            weights[col] = std::numeric_limits<double>::infinity();
+            continue;
+        }
+        auto const frequency = rfftfreq<double>(transform_size, std::max(col, 1zu), 1.0 / sample_rate);
+        weights[col]         = a_weighting(frequency);
+    }
+
+    return weighted_threshold_sparsity(filter, threshold_db, stdex::mdspan{weights.data(), stdex::extents{num_bins}});
+}
+
+/// Relative threshold rising by \p decay_db for every partition
+/// \details Later partitions form the quieter tail of an impulse response and are masked by the head.
+/// \ingroup neo-convolution
+template<in_matrix InMat>
+[[nodiscard]] auto decaying_threshold_sparsity(InMat filter, double threshold_db, double decay_db) -> sparsity_mask
+{
+    auto const reference = detail::max_bin_power(filter);
+    return sparsity_mask{filter, [=](auto row, auto col) {
+                             auto const db = threshold_db + decay_db * static_cast<double>(row);
+                             return detail::bin_power(filter(row, col)) > reference * detail::db_to_power(db);
+                         }};
+}
+
+/// Keeps the \p k loudest bins of every partition
+/// \ingroup neo-convolution
+template<in_matrix InMat>
+[[nodiscard]] auto top_k_sparsity(InMat filter, std::size_t k) -> sparsity_mask
+{
+    auto const rows = filter.extent(0);
+    auto const cols = filter.extent(1);
+
+    auto keep  = std::vector<std::uint8_t>(rows * cols, 0);
+    auto order = std::vector<std::size_t>(cols);
+    for (auto row{0zu}; row < rows; ++row) {
+        std::iota(order.begin(), order.end(), 0zu);
+
+        auto const power = [filter, row](std::size_t col) { return detail::bin_power(filter(row, col)); };
+        auto const nth   = std::next(order.begin(), static_cast<std::ptrdiff_t>(std::min(k, cols)));
+        std::nth_element(order.begin(), nth, order.end(), [&](auto l, auto r) { return power(l) > power(r); });
+        std::for_each(order.begin(), nth, [&](auto col) { keep[row * cols + col] = 1; });
+    }
+
+    return sparsity_mask{filter, [&keep, cols](auto row, auto col) { return keep[row * cols + col] != 0; }};
+}
+
+/// Keeps the fewest bins that preserve at least \p energy (in [0, 1]) of the total filter energy
+/// \ingroup neo-convolution
+template<in_matrix InMat>
+[[nodiscard]] auto energy_sparsity(InMat filter, double energy) -> sparsity_mask
+{
+    auto const rows = filter.extent(0);
+    auto const cols = filter.extent(1);
+
+    auto energies = std::vector<double>(rows * cols);
+    for (auto row{0zu}; row < rows; ++row) {
+        for (auto col{0zu}; col < cols; ++col) {
+            energies[row * cols + col] = detail::bin_power(filter(row, col)) * detail::bin_energy_weight(col, cols);
+        }
+    }
+
+    auto const total = std::accumulate(energies.begin(), energies.end(), 0.0);
+    std::ranges::sort(energies, std::greater{});
+
+    auto num_keep = 0zu;
+    for (auto sum = 0.0; num_keep < energies.size() and sum < energy * total; ++num_keep) {
+        sum += energies[num_keep];
+    }
+
+    auto const cutoff = num_keep > 0 ? energies[num_keep - 1zu] : std::numeric_limits<double>::infinity();
+    return sparsity_mask{filter, [=](auto row, auto col) {
+                             auto const e = detail::bin_power(filter(row, col)) * detail::bin_energy_weight(col, cols);
+                             return e >= cutoff and e > 0.0;
+                         }};
+}
+
+/// Picks the threshold automatically, so that roughly \p target (in [0, 1]) of all bins are removed
+/// \ingroup neo-convolution
+template<in_matrix InMat>
+[[nodiscard]] auto target_sparsity(InMat filter, double target) -> sparsity_mask
+{
+    auto const total    = filter.extent(0) * filter.extent(1);
+    auto const keep     = std::clamp(1.0 - target, 0.0, 1.0) * static_cast<double>(total);
+    auto const num_keep = static_cast<std::size_t>(std::lround(keep));
+    return detail::keep_largest(filter, num_keep);
+}
+
+}  // namespace neo::convolution
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT
+
+#include "sparsity.hpp"
+
+#include <neo/convolution/dense_convolver.hpp>
+#include <neo/convolution/sparse_convolver.hpp>
+#include <neo/convolution/uniform_partition.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <complex>
+#include <tuple>
+
+namespace {
+
+template<typename Float>
+auto make_filter(std::size_t block_size, std::size_t num_partitions)
+{
+    auto impulse = neo::generate_noise_signal<Float>(block_size * num_partitions, Catch::getSeed());
+
+    // Exponential decay, like the tail of a room impulse response
+    for (auto i{0zu}; i < impulse.extent(0); ++i) {
+        impulse(i) *= std::exp(-Float(4) * static_cast<Float>(i) / static_cast<Float>(impulse.extent(0)));
+    }
+
+    auto const matrix = stdex::mdspan{impulse.data(), stdex::extents{1zu, impulse.extent(0)}};
+    return neo::convolution::uniform_partition(matrix, block_size);
+}
+
+auto count_kept(neo::convolution::sparsity_mask const& mask, std::size_t row)
+{
+    auto count = 0zu;
+    for (auto col{0zu}; col < mask.extents().extent(1); ++col) {
+        count += mask(row, col, 0) ? 1zu : 0zu;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/convolution: sparsity", "", float, double)
+{
+    using Float = TestType;
+
+    auto const block_size = GENERATE(as<std::size_t>{}, 64, 256);
+    auto const partitions = make_filter<Float>(block_size, 8);
+    auto const filter     = stdex::submdspan(partitions.to_mdspan(), 0, stdex::full_extent, stdex::full_extent);
+
+    auto const rows = filter.extent(0);
+    auto const cols = filter.extent(1);
+
+    SECTION("threshold")
+    {
+        auto const all = neo::convolution::threshold_sparsity(filter, -1000.0);
+        REQUIRE(all.sparsity() == Catch::Approx(0.0));
+        REQUIRE(all.error() == Catch::Approx(0.0));
+
+        auto const none = neo::convolution::threshold_sparsity(filter, 1000.0);
+        REQUIRE(none.sparsity() == Catch::Approx(1.0));
+        REQUIRE(none.error() == Catch::Approx(1.0));
+
+        auto const relative = neo::convolution::relative_threshold_sparsity(filter, -30.0);
+        auto const stricter = neo::convolution::relative_threshold_sparsity(filter, -10.0);
+        REQUIRE(relative.sparsity() > 0.0);
+        REQUIRE(relative.sparsity() < stricter.sparsity());
+        REQUIRE(relative.error() < stricter.error());
+        REQUIRE(relative.error_db() < -10.0);
+    }
+
+    SECTION("a-weighted")
+    {
+        auto const plain    = neo::convolution::relative_threshold_sparsity(filter, -20.0);
+        auto const weighted = neo::convolution::a_weighted_threshold_sparsity(filter, -20.0, 44'100.0);
+        REQUIRE(weighted.sparsity() > 0.0);
+        REQUIRE(weighted.sparsity() != Catch::Approx(plain.sparsity()));
+
+        auto const low = neo::convolution::a_weighted_threshold_sparsity(filter, -20.0, 44'100.0, 4);
+        for (auto row{0zu}; row < rows; ++row) {
+            for (auto col{0zu}; col < 4zu; ++col) {
+                REQUIRE(low(row, col, 0));
+            }
+        }
+    }
+
+    SECTION("decaying")
+    {
+        auto const flat     = neo::convolution::decaying_threshold_sparsity(filter, -40.0, 0.0);
+        auto const decaying = neo::convolution::decaying_threshold_sparsity(filter, -40.0, 6.0);
+        auto const relative = neo::convolution::relative_threshold_sparsity(filter, -40.0);
+        REQUIRE(flat.sparsity() == Catch::Approx(relative.sparsity()));
+        REQUIRE(decaying.sparsity() > flat.sparsity());
+        REQUIRE(count_kept(decaying, 0) == count_kept(flat, 0));
+    }
+
+    SECTION("top-k")
+    {
+        auto const k    = cols / 4zu;
+        auto const mask = neo::convolution::top_k_sparsity(filter, k);
+        for (auto row{0zu}; row < rows; ++row) {
+            REQUIRE(count_kept(mask, row) == k);
+        }
+        REQUIRE(mask.sparsity() == Catch::Approx(1.0 - double(k) / double(cols)));
+    }
+
+    SECTION("energy")
+    {
+        auto const mask = neo::convolution::energy_sparsity(filter, 0.99);
+        REQUIRE(mask.error() <= 0.01 + 1e-9);
+        REQUIRE(mask.sparsity() > 0.0);
+
+        auto const loose = neo::convolution::energy_sparsity(filter, 0.9);
+        REQUIRE(loose.sparsity() > mask.sparsity());
+    }
+
+    SECTION("target")
+    {
+        auto const target = GENERATE(0.0, 0.25, 0.5, 0.8, 1.0);
+        auto const mask   = neo::convolution::target_sparsity(filter, target);
+        REQUIRE(mask.sparsity() == Catch::Approx(target).margin(1.0 / double(rows * cols)));
+    }
+
+    SECTION("sparse_filter")
+    {
+        using Complex = std::complex<Float>;
+
+        auto const mask = neo::convolution::target_sparsity(filter, 0.5);
+        auto sparse     = neo::convolution::sparse_upols_convolver<Complex>{};
+        auto pruned     = neo::convolution::pruned_sparse_upola_convolver<Complex>{};
+        sparse.filter(filter, mask);
+        pruned.filter(filter, mask);
+
+        // Dense reference with the removed bins zeroed
+        auto masked = stdex::mdarray<Complex, stdex::dextents<std::size_t, 2>>{rows, cols};
+        for (auto row{0zu}; row < rows; ++row) {
+            for (auto col{0zu}; col < cols; ++col) {
+                masked(row, col) = mask(row, col, filter(row, col)) ? filter(row, col) : Complex{};
+            }
+        }
+        auto dense = neo::convolution::upols_convolver<Complex>{};
+        dense.filter(masked.to_mdspan());
+
+        auto const signal = neo::generate_noise_signal<Float>(block_size * 16zu, Catch::getSeed() + 1U);
+        auto expected     = signal;
+        auto sparse_out   = signal;
+        auto pruned_out   = signal;
+        for (auto i{0zu}; i < signal.extent(0); i += block_size) {
+            dense(stdex::submdspan(expected.to_mdspan(), std::tuple{i, i + block_size}));
+            sparse(stdex::submdspan(sparse_out.to_mdspan(), std::tuple{i, i + block_size}));
+            pruned(stdex::submdspan(pruned_out.to_mdspan(), std::tuple{i, i + block_size}));
+        }
+
+        for (auto i{0zu}; i < signal.extent(0); ++i) {
+            CAPTURE(i);
+            REQUIRE_THAT(sparse_out(i), Catch::Matchers::WithinAbs(expected(i), 0.0001));
+            REQUIRE_THAT(pruned_out(i), Catch::Matchers::WithinAbs(expected(i), 0.0001));
+        }
+    }
+}
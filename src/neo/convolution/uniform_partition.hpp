@@ -8,21 +8,40 @@
 
 namespace neo::convolution {
 
+namespace detail {
+
+template<std::floating_point Float>
+[[nodiscard]] auto uniform_partition_options(std::size_t block_size) -> fft::stft_options<Float>
+{
+    return {
+        .frame_size     = block_size,
+        .transform_size = block_size * 2UL,
+        .overlap_size   = 0,
+        .window         = rectangular_window<Float>{},
+    };
+}
+
+}  // namespace detail
+
 /// \ingroup neo-convolution
 template<in_matrix InMat>
 [[nodiscard]] auto uniform_partition(InMat impulse_response, std::size_t block_size)
 {
     using Float = typename InMat::value_type;
 
-    return fft::stft(
-        impulse_response,
-        {
-            .frame_size     = block_size,
-            .transform_size = block_size * 2UL,
-            .overlap_size   = 0,
-            .window         = rectangular_window<Float>{},
-        }
-    );
+    return fft::stft(impulse_response, detail::uniform_partition_options<Float>(block_size));
+}
+
+/// Writes into a channels x partitions x (block_size + 1) output, e.g. the storage of a previous partitioning
+/// \ingroup neo-convolution
+template<in_matrix InMat, typename OutTensor>
+    requires(is_mdspan<OutTensor> and OutTensor::rank() == 3)
+auto uniform_partition(InMat impulse_response, std::size_t block_size, OutTensor out) -> void
+{
+    using Float = typename InMat::value_type;
+
+    auto plan = fft::stft_plan<Float, value_type_t<OutTensor>>{detail::uniform_partition_options<Float>(block_size)};
+    plan(impulse_response, out);
 }
 
 }  // namespace neo::convolution
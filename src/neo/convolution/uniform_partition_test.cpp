@@ -2,7 +2,10 @@
 
 #include "uniform_partition.hpp"
 
+#include <neo/testing/testing.hpp>
+
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 
 TEMPLATE_TEST_CASE("neo/convolution: uniform_partition", "", float, double)
@@ -36,3 +39,23 @@ TEMPLATE_TEST_CASE("neo/convolution: uniform_partition", "", float, double)
         REQUIRE(partitions.extent(2) == 129);
     }
 }
+
+TEMPLATE_TEST_CASE("neo/convolution: uniform_partition(out)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const impulse = neo::generate_noise_signal<Float>(2zu * 1000zu, Catch::getSeed());
+    auto const matrix  = stdex::mdspan{impulse.data(), stdex::extents{2zu, 1000zu}};
+
+    auto const expected = neo::convolution::uniform_partition(matrix, 128);
+    auto actual         = stdex::mdarray<std::complex<Float>, stdex::dextents<std::size_t, 3>>{2, 8, 129};
+    neo::convolution::uniform_partition(matrix, 128, actual.to_mdspan());
+
+    for (auto ch{0zu}; ch < expected.extent(0); ++ch) {
+        for (auto p{0zu}; p < expected.extent(1); ++p) {
+            for (auto bin{0zu}; bin < expected.extent(2); ++bin) {
+                REQUIRE(actual(ch, p, bin) == expected(ch, p, bin));
+            }
+        }
+    }
+}
@@ -3,9 +3,15 @@
 #pragma once
 
 #include <neo/algorithm/copy.hpp>
+#include <neo/algorithm/fill.hpp>
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/convolution/fdl_index.hpp>
+#include <neo/parallel/thread_pool.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace neo::convolution {
 
@@ -24,7 +30,15 @@ struct uniform_partitioned_convolver
     auto filter(in_matrix auto filter, auto... args) -> void;
     auto operator()(in_vector auto block) -> void;
 
+    /// Splits the partitions into groups, which are multiplied & accumulated in parallel.
+    /// Requires Filter::operator() to be safe to call concurrently with different accumulators.
+    auto operator()(in_vector auto block, thread_pool& pool) -> void;
+
 private:
+    static constexpr auto is_pruned = requires(Filter const& f) { f.bins(); };
+
+    auto write_output(inout_vector auto inout) -> void;
+
     Overlap _overlap{1, 1};
 
     Fdl _fdl;
@@ -32,16 +46,30 @@ private:
 
     Filter _filter;
     accumulator_type _accumulator;
+
+    // (fdl, filter) index pairs of the current block and per group accumulators, only used in parallel
+    std::vector<std::pair<std::size_t, std::size_t>> _pairs;
+    std::vector<accumulator_type> _groups;
 };
 
 template<typename Overlap, typename Fdl, typename Filter>
 auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::filter(in_matrix auto filter, auto... args) -> void
 {
-    _overlap     = Overlap{filter.extent(1) - 1, filter.extent(1) - 1};
-    _indexer     = fdl_index<size_t>{filter.extent(0)};
-    _fdl         = Fdl{filter.extents()};
-    _accumulator = accumulator_type{filter.extent(1)};
-    _filter.filter(filter, args...);
+    _overlap = Overlap{filter.extent(1) - 1, filter.extent(1) - 1};
+    _indexer = fdl_index<size_t>{filter.extent(0)};
+    _pairs.resize(filter.extent(0));
+    _groups.clear();
+
+    if constexpr (is_pruned) {
+        // Filter decides which bins survive, fdl & accumulator only hold those
+        _filter.filter(filter, args...);
+        _fdl         = Fdl{filter.extents(), _filter.bins()};
+        _accumulator = accumulator_type{_filter.bins().extent(0)};
+    } else {
+        _fdl         = Fdl{filter.extents()};
+        _accumulator = accumulator_type{filter.extent(1)};
+        _filter.filter(filter, args...);
+    }
 }
 
 template<typename Overlap, typename Fdl, typename Filter>
@@ -54,14 +82,62 @@ auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::operator()(in_vector a
         auto multiply = [this](auto index, auto filter) { _filter(_fdl[index], filter, _accumulator.to_mdspan()); };
         _indexer(insert, multiply);
 
-        if constexpr (accumulator_type::rank() == 1) {
-            copy(_accumulator.to_mdspan(), inout);
-        } else {
-            for (auto i{0}; i < static_cast<int>(inout.extent(0)); ++i) {
-                inout[i] = {_accumulator(0, i), _accumulator(1, i)};
+        write_output(inout);
+    });
+}
+
+template<typename Overlap, typename Fdl, typename Filter>
+auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::operator()(in_vector auto block, thread_pool& pool) -> void
+{
+    auto const num_groups = std::min(pool.concurrency(), _pairs.size());
+    if (_groups.size() != num_groups) {
+        _groups.assign(num_groups, accumulator_type{_accumulator.extents()});
+    }
+
+    _overlap(block, [this, &pool, num_groups](inout_vector auto inout) {
+        auto insert = [this, inout](auto index) { _fdl.insert(inout, index); };
+        auto record = [this, i = 0zu](auto index, auto filter) mutable { _pairs[i++] = {index, filter}; };
+        _indexer(insert, record);
+
+        pool.parallel_for(num_groups, [this, num_groups](std::size_t /*worker*/, std::size_t group) {
+            auto const accumulator = _groups[group].to_mdspan();
+            fill(accumulator, value_type_t<accumulator_type>{});
+
+            auto const first = _pairs.size() * group / num_groups;
+            auto const last  = _pairs.size() * (group + 1zu) / num_groups;
+            for (auto i{first}; i < last; ++i) {
+                _filter(_fdl[_pairs[i].first], _pairs[i].second, accumulator);
+            }
+        });
+
+        copy(_groups[0].to_mdspan(), _accumulator.to_mdspan());
+        for (auto group{1zu}; group < num_groups; ++group) {
+            auto const* partial = _groups[group].data();
+            for (auto i{0zu}; i < _accumulator.size(); ++i) {
+                _accumulator.data()[i] += partial[i];
             }
         }
+
+        write_output(inout);
     });
 }
 
+template<typename Overlap, typename Fdl, typename Filter>
+auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::write_output(inout_vector auto inout) -> void
+{
+    if constexpr (is_pruned) {
+        auto const bins = _filter.bins();
+        fill(inout, value_type_t<decltype(inout)>{});
+        for (auto i{0zu}; i < bins.extent(0); ++i) {
+            inout[bins[i]] = _accumulator(i);
+        }
+    } else if constexpr (accumulator_type::rank() == 1) {
+        copy(_accumulator.to_mdspan(), inout);
+    } else {
+        for (auto i{0}; i < static_cast<int>(inout.extent(0)); ++i) {
+            inout[i] = {_accumulator(0, i), _accumulator(1, i)};
+        }
+    }
+}
+
 }  // namespace neo::convolution
@@ -25,12 +25,19 @@ constexpr auto is_sparse_convolver<
     neo::convolution::uniform_partitioned_convolver<Overlap, Fdl, neo::convolution::sparse_filter<Complex>>>
     = true;
 
+template<typename Complex, typename Overlap, typename Fdl>
+constexpr auto is_sparse_convolver<
+    neo::convolution::uniform_partitioned_convolver<Overlap, Fdl, neo::convolution::pruned_sparse_filter<Complex>>>
+    = true;
+
 }  // namespace
 
 static_assert(not is_sparse_convolver<neo::convolution::upola_convolver<std::complex<float>>>);
 static_assert(not is_sparse_convolver<neo::convolution::upols_convolver<std::complex<float>>>);
 static_assert(is_sparse_convolver<neo::convolution::sparse_upols_convolver<std::complex<float>>>);
 static_assert(is_sparse_convolver<neo::convolution::sparse_upola_convolver<std::complex<float>>>);
+static_assert(is_sparse_convolver<neo::convolution::pruned_sparse_upols_convolver<std::complex<float>>>);
+static_assert(is_sparse_convolver<neo::convolution::pruned_sparse_upola_convolver<std::complex<float>>>);
 
 TEMPLATE_PRODUCT_TEST_CASE(
     "neo/convolution: convolver",
@@ -41,7 +48,9 @@ TEMPLATE_PRODUCT_TEST_CASE(
      neo::convolution::split_upola_convolver,
      neo::convolution::split_upols_convolver,
      neo::convolution::sparse_upola_convolver,
-     neo::convolution::sparse_upols_convolver),
+     neo::convolution::sparse_upols_convolver,
+     neo::convolution::pruned_sparse_upola_convolver,
+     neo::convolution::pruned_sparse_upols_convolver),
     (std::complex<float>, std::complex<double>)
 )
 {
@@ -73,3 +82,94 @@ TEMPLATE_PRODUCT_TEST_CASE(
 
     REQUIRE(neo::allclose(output.to_mdspan(), signal.to_mdspan()));
 }
+
+TEMPLATE_TEST_CASE("neo/convolution: pruned_sparse_upols_convolver", "", std::complex<float>, std::complex<double>)
+{
+    using Complex = TestType;
+    using Float   = typename Complex::value_type;
+
+    auto const block_size = GENERATE(as<std::size_t>{}, 128, 256);
+    CAPTURE(block_size);
+
+    auto const impulse = neo::generate_noise_signal<Float>(block_size * 3zu, Catch::getSeed());
+    auto const matrix  = stdex::mdspan{impulse.data(), stdex::extents{1zu, impulse.extent(0)}};
+    auto const filter  = neo::convolution::uniform_partition(matrix, block_size);
+    auto const channel = stdex::submdspan(filter.to_mdspan(), 0, stdex::full_extent, stdex::full_extent);
+
+    // Drop the upper half of the spectrum and a band in the middle
+    auto const num_bins = channel.extent(1);
+    auto const keep     = [num_bins](auto row, auto col, auto) {
+        return col < num_bins / 2zu and (col < 10zu or col > 20zu + row);
+    };
+
+    auto const signal = neo::generate_noise_signal<Float>(block_size * 8zu, Catch::getSeed() + 1U);
+    auto expected     = signal;
+    auto actual       = signal;
+
+    auto sparse = neo::convolution::sparse_upols_convolver<Complex>{};
+    auto pruned = neo::convolution::pruned_sparse_upols_convolver<Complex>{};
+    sparse.filter(channel, keep);
+    pruned.filter(channel, keep);
+
+    for (std::size_t i{0}; i < signal.extent(0); i += block_size) {
+        sparse(stdex::submdspan(expected.to_mdspan(), std::tuple{i, i + block_size}));
+        pruned(stdex::submdspan(actual.to_mdspan(), std::tuple{i, i + block_size}));
+    }
+
+    for (auto i{0zu}; i < signal.extent(0); ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(actual(i), Catch::Matchers::WithinAbs(expected(i), 0.00001));
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/convolution: convolver(thread_pool)",
+    "",
+    (neo::convolution::upols_convolver,
+     neo::convolution::upola_convolver,
+     neo::convolution::split_upols_convolver,
+     neo::convolution::pruned_sparse_upols_convolver),
+    (std::complex<float>, std::complex<double>)
+)
+{
+    using Convolver = TestType;
+    using Complex   = typename Convolver::value_type;
+    using Float     = typename Complex::value_type;
+
+    auto const num_workers    = GENERATE(as<std::size_t>{}, 0, 1, 3, 16);
+    auto const num_partitions = GENERATE(as<std::size_t>{}, 1, 2, 9);
+    auto const block_size     = 128zu;
+    CAPTURE(num_workers);
+    CAPTURE(num_partitions);
+
+    auto const impulse = neo::generate_noise_signal<Float>(block_size * num_partitions, Catch::getSeed());
+    auto const matrix  = stdex::mdspan{impulse.data(), stdex::extents{1zu, impulse.extent(0)}};
+    auto const filter  = neo::convolution::uniform_partition(matrix, block_size);
+    auto const channel = stdex::submdspan(filter.to_mdspan(), 0, stdex::full_extent, stdex::full_extent);
+
+    auto serial   = Convolver{};
+    auto parallel = Convolver{};
+    if constexpr (is_sparse_convolver<Convolver>) {
+        serial.filter(channel, [](auto, auto col, auto) { return col % 3 != 0; });
+        parallel.filter(channel, [](auto, auto col, auto) { return col % 3 != 0; });
+    } else {
+        serial.filter(channel);
+        parallel.filter(channel);
+    }
+
+    auto const signal = neo::generate_noise_signal<Float>(block_size * 16zu, Catch::getSeed() + 1U);
+    auto expected     = signal;
+    auto actual       = signal;
+
+    auto pool = neo::thread_pool{num_workers};
+    for (std::size_t i{0}; i < signal.extent(0); i += block_size) {
+        serial(stdex::submdspan(expected.to_mdspan(), std::tuple{i, i + block_size}));
+        parallel(stdex::submdspan(actual.to_mdspan(), std::tuple{i, i + block_size}), pool);
+    }
+
+    // Partial sums are added in a different order
+    for (auto i{0zu}; i < signal.extent(0); ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(actual(i), Catch::Matchers::WithinAbs(expected(i), 0.0001));
+    }
+}
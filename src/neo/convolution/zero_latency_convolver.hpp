@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/algorithm/copy.hpp>
+#include <neo/algorithm/fill.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/convolution/dense_convolver.hpp>
+#include <neo/convolution/direct_fir.hpp>
+#include <neo/convolution/uniform_partition.hpp>
+
+#include <algorithm>
+#include <complex>
+#include <concepts>
+
+namespace neo::convolution {
+
+/// Convolver without added latency for blocks of any size.
+///
+/// The first partition of the impulse response is computed in the time domain
+/// with direct_fir. The remaining partitions are run by the uniformly partitioned
+/// \p Convolver, once per completed partition block. Their output is only needed
+/// one block later, so no latency is introduced.
+///
+/// \ingroup neo-convolution
+template<std::floating_point Float, typename Convolver = upols_convolver<std::complex<Float>>>
+struct zero_latency_convolver
+{
+    using value_type     = Float;
+    using convolver_type = Convolver;
+
+    zero_latency_convolver() = default;
+
+    auto filter(in_vector_of<Float> auto impulse, std::size_t partition_size) -> void;
+    auto operator()(inout_vector_of<Float> auto block) -> void;
+
+private:
+    direct_fir<Float> _head;
+    Convolver _tail;
+    bool _has_tail{false};
+
+    stdex::mdarray<Float, stdex::dextents<size_t, 1>> _input;
+    stdex::mdarray<Float, stdex::dextents<size_t, 1>> _tail_output;
+    std::size_t _position{0};
+};
+
+template<std::floating_point Float, typename Convolver>
+auto zero_latency_convolver<Float, Convolver>::filter(in_vector_of<Float> auto impulse, std::size_t partition_size)
+    -> void
+{
+    auto const head_size = std::min(impulse.extent(0), partition_size);
+    _head.filter(stdex::submdspan(impulse, std::tuple{0zu, head_size}));
+
+    _input       = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{partition_size};
+    _tail_output = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{partition_size};
+    _position    = 0;
+    _has_tail    = impulse.extent(0) > partition_size;
+
+    if (_has_tail) {
+        auto tail = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{1zu, impulse.extent(0) - partition_size};
+        for (auto i{0zu}; i < tail.extent(1); ++i) {
+            tail(0, i) = impulse[partition_size + i];
+        }
+
+        auto const partitions = uniform_partition(tail.to_mdspan(), partition_size);
+        _tail.filter(stdex::submdspan(partitions.to_mdspan(), 0, stdex::full_extent, stdex::full_extent));
+    }
+}
+
+template<std::floating_point Float, typename Convolver>
+auto zero_latency_convolver<Float, Convolver>::operator()(inout_vector_of<Float> auto block) -> void
+{
+    auto const partition_size = _input.extent(0);
+
+    for (auto offset{0zu}; offset < block.extent(0);) {
+        auto const size  = std::min(block.extent(0) - offset, partition_size - _position);
+        auto const io    = stdex::submdspan(block, std::tuple{offset, offset + size});
+        auto const input = stdex::submdspan(_input.to_mdspan(), std::tuple{_position, _position + size});
+        auto const tail  = stdex::submdspan(_tail_output.to_mdspan(), std::tuple{_position, _position + size});
+
+        copy(io, input);
+        _head(io);
+        for (auto i{0zu}; i < size; ++i) {
+            io[i] += tail[i];
+        }
+
+        offset += size;
+        _position += size;
+
+        if (_position == partition_size) {
+            _position = 0;
+            if (_has_tail) {
+                copy(_input.to_mdspan(), _tail_output.to_mdspan());
+                _tail(_tail_output.to_mdspan());
+            }
+        }
+    }
+}
+
+}  // namespace neo::convolution
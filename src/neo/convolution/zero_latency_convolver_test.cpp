@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+
+#include "zero_latency_convolver.hpp"
+
+#include <neo/convolution/direct_convolve.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+TEMPLATE_TEST_CASE("neo/convolution: zero_latency_convolver", "", float, double)
+{
+    using Float = TestType;
+
+    auto const partition_size = GENERATE(as<std::size_t>{}, 64, 128);
+    auto const impulse_size   = GENERATE(as<std::size_t>{}, 1, 50, 128, 129, 500, 1024);
+    auto const block_size     = GENERATE(as<std::size_t>{}, 1, 31, 64, 200);
+    CAPTURE(partition_size);
+    CAPTURE(impulse_size);
+    CAPTURE(block_size);
+
+    auto const impulse  = neo::generate_noise_signal<Float>(impulse_size, Catch::getSeed());
+    auto const signal   = neo::generate_noise_signal<Float>(2048, Catch::getSeed() + 1U);
+    auto const expected = neo::convolution::direct_convolve(signal.to_mdspan(), impulse.to_mdspan());
+
+    auto convolver = neo::convolution::zero_latency_convolver<Float>{};
+    convolver.filter(impulse.to_mdspan(), partition_size);
+
+    auto output = signal;
+    for (auto i{0zu}; i < output.extent(0); i += block_size) {
+        auto const last = std::min(i + block_size, output.extent(0));
+        convolver(stdex::submdspan(output.to_mdspan(), std::tuple{i, last}));
+    }
+
+    for (auto i{0zu}; i < output.extent(0); ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(output(i), Catch::Matchers::WithinAbs(expected(i), 0.001));
+    }
+}
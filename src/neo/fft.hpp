@@ -7,16 +7,23 @@
 
 #include <neo/config.hpp>
 
+#include <neo/fft/czt.hpp>
 #include <neo/fft/dct.hpp>
 #include <neo/fft/dft.hpp>
 #include <neo/fft/direction.hpp>
 #include <neo/fft/fft.hpp>
+#include <neo/fft/goertzel.hpp>
+#include <neo/fft/log_mel_spectrogram.hpp>
+#include <neo/fft/mdct.hpp>
+#include <neo/fft/mel_filterbank.hpp>
 #include <neo/fft/norm.hpp>
 #include <neo/fft/order.hpp>
 #include <neo/fft/rfft.hpp>
 #include <neo/fft/rfftfreq.hpp>
+#include <neo/fft/sliding_dft.hpp>
 #include <neo/fft/split_fft.hpp>
 #include <neo/fft/stft.hpp>
+#include <neo/fft/stft_processor.hpp>
 #include <neo/fft/twiddle.hpp>
 
 #include <neo/fft/experimental/rfft.hpp>
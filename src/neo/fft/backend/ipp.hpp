@@ -8,6 +8,7 @@
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/fft/direction.hpp>
+#include <neo/fft/norm.hpp>
 #include <neo/fft/order.hpp>
 #include <neo/type_traits/always_false.hpp>
 
@@ -51,10 +52,9 @@ inline auto ipp_check(int status) -> void
 }
 
 template<typename Setup>
-[[nodiscard]] auto make_ipp_fft_handle(std::size_t order)
+[[nodiscard]] auto make_ipp_fft_handle(std::size_t order, int flag = IPP_FFT_NODIV_BY_ANY)
     -> std::tuple<typename Setup::handle_type*, ipp_buffer, ipp_buffer>
 {
-    static constexpr auto flag = IPP_FFT_NODIV_BY_ANY;
     static constexpr auto hint = ippAlgHintNone;
 
     int spec_size = 0;
@@ -411,9 +411,11 @@ struct intel_ipp_rfft_plan
     using complex_type = Complex;
     using size_type    = std::size_t;
 
-    intel_ipp_rfft_plan(from_order_tag /*tag*/, size_type order) : _order{order}
+    intel_ipp_rfft_plan(from_order_tag /*tag*/, size_type order, fft::norm norm = fft::norm::none)
+        : _order{order}
+        , _norm{norm}
     {
-        std::tie(_handle, _spec_buf, _work_buf) = detail::make_ipp_fft_handle<setup>(order);
+        std::tie(_handle, _spec_buf, _work_buf) = detail::make_ipp_fft_handle<setup>(order, ipp_flag(norm));
     }
 
     intel_ipp_rfft_plan(intel_ipp_rfft_plan const& other)                    = delete;
@@ -426,6 +428,8 @@ struct intel_ipp_rfft_plan
 
     [[nodiscard]] auto order() const noexcept -> size_type { return _order; }
 
+    [[nodiscard]] auto norm() const noexcept -> fft::norm { return _norm; }
+
     [[nodiscard]] auto size() const noexcept -> size_type { return neo::ipow<2zu>(order()); }
 
     template<in_vector_of<Float> InVec, out_vector_of<complex_type> OutVec>
@@ -496,7 +500,18 @@ private:
 
     using setup = std::conditional_t<std::same_as<real_type, float>, setup_f32, setup_f64>;
 
+    [[nodiscard]] static auto ipp_flag(fft::norm norm) noexcept -> int
+    {
+        switch (norm) {
+            case fft::norm::backward: return IPP_FFT_DIV_INV_BY_N;
+            case fft::norm::forward: return IPP_FFT_DIV_FWD_BY_N;
+            case fft::norm::ortho: return IPP_DIV_BY_SQRTN;
+            default: return IPP_FFT_NODIV_BY_ANY;
+        }
+    }
+
     size_type _order;
+    fft::norm _norm;
     stdex::mdarray<typename setup::float_type, stdex::dextents<size_t, 1>> _buffer{size() * 2};
     typename setup::handle_type* _handle;
     detail::ipp_buffer _spec_buf;
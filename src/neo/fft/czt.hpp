@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/algorithm/fill.hpp>
+#include <neo/algorithm/multiply.hpp>
+#include <neo/complex/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fft/fft.hpp>
+#include <neo/fft/twiddle.hpp>
+#include <neo/math/conj.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace neo::fft {
+
+/// Chirp-Z transform along an arc of the unit circle (zoom FFT).
+///
+/// X[k] = sum x[n] * exp(-2i * pi * (start + k * step) * n) for k in [0, num_points()).
+/// Frequencies are in cycles per sample, so for a sample rate fs, start = 50 / fs &
+/// step = 1 / fs with 21 points gives 1 Hz bins from 50 to 70 Hz. With Bluestein's
+/// identity this is a convolution of size next_pow2(size() + num_points() - 1), whose
+/// chirp spectrum is computed once by the constructor. Compared to zero padding a FFT to
+/// the same bin spacing, the cost depends on the number of points instead of sample_rate / step.
+/// The resolution of the underlying signal is still limited to 1 / size() cycles per sample.
+///
+/// \ingroup neo-fft
+template<complex Complex>
+struct czt_plan
+{
+    using value_type = Complex;
+    using real_type  = typename Complex::value_type;
+    using size_type  = std::size_t;
+
+    /// Start & step are double, because the phase of the chirp grows with num_points()^2
+    czt_plan(size_type size, size_type num_points, double start, double step);
+
+    [[nodiscard]] auto size() const noexcept -> size_type { return _size; }
+
+    [[nodiscard]] auto num_points() const noexcept -> size_type { return _num_points; }
+
+    [[nodiscard]] auto start() const noexcept -> double { return _start; }
+
+    [[nodiscard]] auto step() const noexcept -> double { return _step; }
+
+    /// Real or complex input, x & out may alias
+    template<in_vector InVec, out_vector OutVec>
+        requires(
+            (std::same_as<value_type_t<InVec>, Complex> or std::same_as<value_type_t<InVec>, real_type>)
+            and std::same_as<value_type_t<OutVec>, Complex>
+        )
+    auto operator()(InVec x, OutVec out) -> void;
+
+private:
+    size_type _size;
+    size_type _num_points;
+    double _start;
+    double _step;
+
+    fft_plan<Complex> _plan{fft::from_order, fft::next_order(size() + num_points() - 1zu)};
+
+    stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>> _prechirp{size()};
+    stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>> _postchirp{num_points()};
+    stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>> _filter{_plan.size()};
+    stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>> _buffer{_plan.size()};
+};
+
+template<complex Complex>
+czt_plan<Complex>::czt_plan(size_type size, size_type num_points, double start, double step)
+    : _size{size}
+    , _num_points{num_points}
+    , _start{start}
+    , _step{step}
+{
+    assert(size > 0);
+    assert(num_points > 0);
+
+    // nk = (n^2 + k^2 - (k - n)^2) / 2
+    auto chirp = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{std::max(size, num_points)};
+    fill_chirp(chirp.to_mdspan(), 0.0, step);
+    fill_chirp(_prechirp.to_mdspan(), start, step);
+    for (auto k{0zu}; k < num_points; ++k) {
+        _postchirp(k) = chirp(k);
+    }
+
+    // exp(i * pi * step * m^2) for m in (-size, num_points), negative m wrap around
+    auto const filter = _filter.to_mdspan();
+    auto const length = filter.extent(0);
+    fill(filter, Complex{});
+    for (auto m{0zu}; m < num_points; ++m) {
+        filter[m] = math::conj(chirp(m));
+    }
+    for (auto m{1zu}; m < size; ++m) {
+        filter[length - m] = math::conj(chirp(m));
+    }
+
+    // The 1 / N of the inverse transform is folded into the chirp spectrum
+    neo::fft::fft(_plan, filter);
+    auto const scale = real_type(1) / static_cast<real_type>(length);
+    for (auto i{0zu}; i < length; ++i) {
+        filter[i] = Complex{filter[i].real() * scale, filter[i].imag() * scale};
+    }
+}
+
+template<complex Complex>
+template<in_vector InVec, out_vector OutVec>
+    requires(
+        (std::same_as<value_type_t<InVec>, Complex> or std::same_as<value_type_t<InVec>, typename Complex::value_type>)
+        and std::same_as<value_type_t<OutVec>, Complex>
+    )
+auto czt_plan<Complex>::operator()(InVec x, OutVec out) -> void
+{
+    assert(std::cmp_equal(x.extent(0), size()));
+    assert(std::cmp_equal(out.extent(0), num_points()));
+
+    auto const buffer = _buffer.to_mdspan();
+    auto const w      = _prechirp.to_mdspan();
+
+    if constexpr (std::same_as<value_type_t<InVec>, Complex>) {
+        multiply(x, w, stdex::submdspan(buffer, std::tuple{0, size()}));
+    } else {
+        for (auto n{0zu}; n < size(); ++n) {
+            buffer[n] = Complex{w[n].real() * x[n], w[n].imag() * x[n]};
+        }
+    }
+    fill(stdex::submdspan(buffer, std::tuple{size(), buffer.extent(0)}), Complex{});
+
+    neo::fft::fft(_plan, buffer);
+    multiply(buffer, _filter.to_mdspan(), buffer);
+    neo::fft::ifft(_plan, buffer);
+
+    multiply(stdex::submdspan(buffer, std::tuple{0, num_points()}), _postchirp.to_mdspan(), out);
+}
+
+}  // namespace neo::fft
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MIT
+
+#include "czt.hpp"
+
+#include <neo/complex/scalar_complex.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+
+namespace {
+
+template<typename InVec>
+auto czt_point(InVec x, double frequency) -> std::complex<double>
+{
+    auto sum = std::complex<double>{};
+    for (auto n{0zu}; n < x.extent(0); ++n) {
+        auto const sample = std::complex<double>{x[n]};
+        sum += sample * std::polar(1.0, -std::numbers::pi * 2.0 * frequency * static_cast<double>(n));
+    }
+    return sum;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/fft: czt_plan", "", std::complex<float>, std::complex<double>)
+{
+    using Complex = TestType;
+    using Float   = typename Complex::value_type;
+
+    auto const size       = GENERATE(as<std::size_t>{}, 7, 64, 1000);
+    auto const num_points = GENERATE(as<std::size_t>{}, 1, 21, 300);
+    auto const start      = GENERATE(0.0, 0.1, -0.25);
+    auto const step       = GENERATE(1e-3, -2e-4, 0.01);
+    CAPTURE(size, num_points, start, step);
+
+    auto plan = neo::fft::czt_plan<Complex>{size, num_points, start, step};
+    REQUIRE(plan.size() == size);
+    REQUIRE(plan.num_points() == num_points);
+    REQUIRE(plan.start() == start);
+    REQUIRE(plan.step() == step);
+
+    auto const tolerance = (std::same_as<Float, float> ? 1e-5 : 1e-12) * double(size);
+    auto out             = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{num_points};
+
+    SECTION("real")
+    {
+        auto const x = neo::generate_noise_signal<Float>(size, Catch::getSeed());
+        plan(x.to_mdspan(), out.to_mdspan());
+
+        for (auto k{0zu}; k < num_points; ++k) {
+            auto const expected = czt_point(x.to_mdspan(), start + static_cast<double>(k) * step);
+            REQUIRE_THAT(out(k).real(), Catch::Matchers::WithinAbs(expected.real(), tolerance));
+            REQUIRE_THAT(out(k).imag(), Catch::Matchers::WithinAbs(expected.imag(), tolerance));
+        }
+    }
+
+    SECTION("complex")
+    {
+        auto const x = neo::generate_noise_signal<Complex>(size, Catch::getSeed());
+        plan(x.to_mdspan(), out.to_mdspan());
+
+        for (auto k{0zu}; k < num_points; ++k) {
+            auto const expected = czt_point(x.to_mdspan(), start + static_cast<double>(k) * step);
+            REQUIRE_THAT(out(k).real(), Catch::Matchers::WithinAbs(expected.real(), tolerance));
+            REQUIRE_THAT(out(k).imag(), Catch::Matchers::WithinAbs(expected.imag(), tolerance));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/fft: czt_plan(zoom)", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    // 1 Hz bins from 50 to 70 Hz of a 61 Hz sine, one second at 48 kHz
+    auto const sample_rate = 48'000.0;
+    auto const size        = 48'000zu;
+
+    auto x = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+    for (auto n{0zu}; n < size; ++n) {
+        x(n) = static_cast<Float>(std::sin(std::numbers::pi * 2.0 * 61.0 * static_cast<double>(n) / sample_rate));
+    }
+
+    auto plan = neo::fft::czt_plan<Complex>{size, 21zu, 50.0 / sample_rate, 1.0 / sample_rate};
+    auto out  = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{21zu};
+    plan(x.to_mdspan(), out.to_mdspan());
+
+    for (auto k{0zu}; k < 21zu; ++k) {
+        CAPTURE(k);
+        auto const expected = k == 11zu ? static_cast<double>(size) * 0.5 : 0.0;
+        REQUIRE_THAT(std::abs(out(k)), Catch::Matchers::WithinAbs(expected, 0.5));
+    }
+}
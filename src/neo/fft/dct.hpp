@@ -5,17 +5,282 @@
 #include <neo/algorithm/copy.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/fft/fft.hpp>
+#include <neo/fft/twiddle.hpp>
+#include <neo/math/conj.hpp>
+#include <neo/math/sincos.hpp>
 
 #if defined(NEO_HAS_INTEL_IPP)
     #include <neo/fft/backend/ipp.hpp>
 #endif
 
 #include <cassert>
+#include <complex>
 #include <concepts>
 #include <cstddef>
+#include <numbers>
+#include <utility>
 
 namespace neo::fft {
 
+namespace detail {
+
+/// Twiddles & buffers shared by the DCTs built on a N/2 point complex FFT
+template<std::floating_point Float>
+struct half_size_dct_base
+{
+    using value_type = Float;
+    using size_type  = std::size_t;
+
+    half_size_dct_base(from_order_tag tag, size_type order) : _order{order}, _fft{tag, order - 1zu}
+    {
+        assert(order > 0);
+    }
+
+    [[nodiscard]] auto order() const noexcept -> size_type { return _order; }
+
+    [[nodiscard]] auto size() const noexcept -> size_type { return _fft.size() * 2zu; }
+
+protected:
+    auto transform(stdex::mdspan<std::complex<Float>, stdex::dextents<size_type, 1>> buf, direction dir) -> void
+    {
+        // The DFT of a single value is the identity
+        if (_fft.size() > 1) {
+            _fft(buf, dir);
+        }
+    }
+
+    /// lut[k] = exp(-i * pi * k * scale / denominator) for k in [0, lut.extent(0))
+    [[nodiscard]] static auto
+    make_twiddles(size_type size, size_type denominator, size_type scale = 1, size_type offset = 0)
+    {
+        auto const step = -std::numbers::pi / static_cast<double>(denominator);
+
+        auto lut = stdex::mdarray<std::complex<Float>, stdex::dextents<size_type, 1>>{size};
+        for (auto k{0zu}; k < size; ++k) {
+            auto const [s, c] = fast_sincos(step * static_cast<double>(k * scale + offset));
+            lut(k)            = std::complex<Float>{static_cast<Float>(c), static_cast<Float>(s)};
+        }
+        return lut;
+    }
+
+    size_type _order;
+    fft_plan<std::complex<Float>> _fft;
+    stdex::mdarray<std::complex<Float>, stdex::dextents<size_type, 1>> _buffer{_fft.size()};
+};
+
+}  // namespace detail
+
+/// Type 2 DCT using a N/2 point complex FFT, unnormalized like scipy.fft.dct(x, type=2)
+///
+/// The input is reordered into a sequence whose real N point DFT gives the DCT after a
+/// post-twiddle (Makhoul). That real DFT is computed with a half size complex FFT.
+/// \ingroup neo-fft
+template<std::floating_point Float>
+struct dct2_plan : detail::half_size_dct_base<Float>
+{
+    using value_type = Float;
+    using size_type  = std::size_t;
+
+    dct2_plan(from_order_tag tag, size_type order) : detail::half_size_dct_base<Float>{tag, order} {}
+
+    template<inout_vector Vec>
+        requires std::same_as<value_type_t<Vec>, Float>
+    auto operator()(Vec x) noexcept -> void;
+
+    /// Transforms every row
+    template<inout_matrix Mat>
+        requires std::same_as<value_type_t<Mat>, Float>
+    auto operator()(Mat x) noexcept -> void
+    {
+        for (auto row{0zu}; row < x.extent(0); ++row) {
+            (*this)(stdex::submdspan(x, row, stdex::full_extent));
+        }
+    }
+
+private:
+    using base = detail::half_size_dct_base<Float>;
+
+    // exp(-2i*pi*k/N) to split the real DFT & exp(-i*pi*k/2N) for the DCT, k <= N/2
+    stdex::mdarray<std::complex<Float>, stdex::dextents<size_type, 1>> _split{
+        base::make_twiddles(base::size() / 2zu + 1zu, base::size() / 2zu)
+    };
+    stdex::mdarray<std::complex<Float>, stdex::dextents<size_type, 1>> _post{
+        base::make_twiddles(base::size() / 2zu + 1zu, base::size() * 2zu)
+    };
+};
+
+template<std::floating_point Float>
+template<inout_vector Vec>
+    requires std::same_as<value_type_t<Vec>, Float>
+auto dct2_plan<Float>::operator()(Vec x) noexcept -> void
+{
+    using Complex = std::complex<Float>;
+
+    auto const n   = base::size();
+    auto const m   = n / 2zu;
+    auto const buf = base::_buffer.to_mdspan();
+    assert(std::cmp_equal(x.extent(0), n));
+
+    // v = [x0, x2, x4, ..., x5, x3, x1] packed as z[j] = v[2j] + i * v[2j+1]
+    auto const v = [x, n, m](size_type j) { return j < m ? x[j * 2zu] : x[(n - 1zu - j) * 2zu + 1zu]; };
+    for (auto j{0zu}; j < m; ++j) {
+        buf[j] = Complex{v(j * 2zu), v(j * 2zu + 1zu)};
+    }
+
+    base::transform(buf, direction::forward);
+
+    // Real DFT V[k] from the half size complex one, then y[k] = 2 * Re(w[k]) & y[N-k] = -2 * Im(w[k])
+    for (auto k{0zu}; k <= m; ++k) {
+        auto const zk = buf[k % m];
+        auto const zc = math::conj(buf[(m - k) % m]);
+        auto const vk = (zk + zc) + _split(k) * (zk - zc) * Complex{Float(0), Float(-1)};
+        auto const wk = _post(k) * vk;
+
+        x[k] = wk.real();
+        if (k != 0 and k != m) {
+            x[n - k] = -wk.imag();
+        }
+    }
+}
+
+/// Type 3 DCT using a N/2 point complex FFT, unnormalized like scipy.fft.dct(x, type=3)
+///
+/// Runs the steps of dct2_plan in reverse, dct3(dct2(x)) == 2N * x.
+/// \ingroup neo-fft
+template<std::floating_point Float>
+struct dct3_plan : detail::half_size_dct_base<Float>
+{
+    using value_type = Float;
+    using size_type  = std::size_t;
+
+    dct3_plan(from_order_tag tag, size_type order) : detail::half_size_dct_base<Float>{tag, order} {}
+
+    template<inout_vector Vec>
+        requires std::same_as<value_type_t<Vec>, Float>
+    auto operator()(Vec x) noexcept -> void;
+
+    /// Transforms every row
+    template<inout_matrix Mat>
+        requires std::same_as<value_type_t<Mat>, Float>
+    auto operator()(Mat x) noexcept -> void
+    {
+        for (auto row{0zu}; row < x.extent(0); ++row) {
+            (*this)(stdex::submdspan(x, row, stdex::full_extent));
+        }
+    }
+
+private:
+    using base = detail::half_size_dct_base<Float>;
+
+    // Conjugates of the dct2_plan twiddles, k <= N/2
+    stdex::mdarray<std::complex<Float>, stdex::dextents<size_type, 1>> _split{
+        base::make_twiddles(base::size() / 2zu + 1zu, base::size() / 2zu)
+    };
+    stdex::mdarray<std::complex<Float>, stdex::dextents<size_type, 1>> _post{
+        base::make_twiddles(base::size() / 2zu + 1zu, base::size() * 2zu)
+    };
+};
+
+template<std::floating_point Float>
+template<inout_vector Vec>
+    requires std::same_as<value_type_t<Vec>, Float>
+auto dct3_plan<Float>::operator()(Vec x) noexcept -> void
+{
+    using Complex = std::complex<Float>;
+
+    auto const n   = base::size();
+    auto const m   = n / 2zu;
+    auto const buf = base::_buffer.to_mdspan();
+    assert(std::cmp_equal(x.extent(0), n));
+
+    // Real DFT V[k] of the reordered sequence, scaled by 2
+    auto const spectrum = [this, x, n](size_type k) {
+        auto const imag = k == 0 ? Float(0) : -x[n - k];
+        return math::conj(_post(k)) * Complex{x[k], imag};
+    };
+
+    // Even & odd half size DFTs packed as z[k] = e[k] + i * o[k], scaled by 4
+    for (auto k{0zu}; k < m; ++k) {
+        auto const vk = spectrum(k);
+        auto const vc = math::conj(spectrum(m - k));
+        buf[k]        = (vk + vc) + Complex{Float(0), Float(1)} * (vk - vc) * math::conj(_split(k));
+    }
+
+    base::transform(buf, direction::backward);
+
+    // Undo the reordering, the unnormalized inverse FFT supplies the remaining N/2
+    auto const idx = [n, m](size_type j) { return j < m ? j * 2zu : (n - 1zu - j) * 2zu + 1zu; };
+    for (auto j{0zu}; j < m; ++j) {
+        x[idx(j * 2zu)]       = buf[j].real();
+        x[idx(j * 2zu + 1zu)] = buf[j].imag();
+    }
+}
+
+/// Type 4 DCT using a N/2 point complex FFT, unnormalized like scipy.fft.dct(x, type=4)
+///
+/// Even & reversed odd samples are packed into one complex sequence with a pre-twiddle,
+/// after the FFT a post-twiddle yields the even and odd outputs. dct4(dct4(x)) == 2N * x.
+/// This is the core of the MDCT.
+/// \ingroup neo-fft
+template<std::floating_point Float>
+struct dct4_plan : detail::half_size_dct_base<Float>
+{
+    using value_type = Float;
+    using size_type  = std::size_t;
+
+    dct4_plan(from_order_tag tag, size_type order) : detail::half_size_dct_base<Float>{tag, order} {}
+
+    template<inout_vector Vec>
+        requires std::same_as<value_type_t<Vec>, Float>
+    auto operator()(Vec x) noexcept -> void;
+
+    /// Transforms every row
+    template<inout_matrix Mat>
+        requires std::same_as<value_type_t<Mat>, Float>
+    auto operator()(Mat x) noexcept -> void
+    {
+        for (auto row{0zu}; row < x.extent(0); ++row) {
+            (*this)(stdex::submdspan(x, row, stdex::full_extent));
+        }
+    }
+
+private:
+    using base = detail::half_size_dct_base<Float>;
+
+    // exp(-i*pi*n/N) & exp(-i*pi*(4k+1)/4N), n,k < N/2
+    stdex::mdarray<std::complex<Float>, stdex::dextents<size_type, 1>> _pre{
+        base::make_twiddles(base::size() / 2zu, base::size())
+    };
+    stdex::mdarray<std::complex<Float>, stdex::dextents<size_type, 1>> _post{
+        base::make_twiddles(base::size() / 2zu, base::size() * 4zu, 4zu, 1zu)
+    };
+};
+
+template<std::floating_point Float>
+template<inout_vector Vec>
+    requires std::same_as<value_type_t<Vec>, Float>
+auto dct4_plan<Float>::operator()(Vec x) noexcept -> void
+{
+    using Complex = std::complex<Float>;
+
+    auto const n   = base::size();
+    auto const m   = n / 2zu;
+    auto const buf = base::_buffer.to_mdspan();
+    assert(std::cmp_equal(x.extent(0), n));
+
+    for (auto j{0zu}; j < m; ++j) {
+        buf[j] = Complex{x[j * 2zu], x[n - 1zu - j * 2zu]} * _pre(j);
+    }
+
+    base::transform(buf, direction::forward);
+
+    for (auto k{0zu}; k < m; ++k) {
+        auto const uk        = buf[k] * _post(k);
+        x[k * 2zu]           = Float(2) * uk.real();
+        x[n - 1zu - k * 2zu] = Float(-2) * uk.imag();
+    }
+}
+
 /// Type 2 DCT using N FFT (Makhoul)
 ///
 /// https://dsp.stackexchange.com/questions/2807/fast-cosine-transform-via-fft/10606#10606
@@ -2,10 +2,17 @@
 
 #include "dct.hpp"
 
+#include <neo/testing/testing.hpp>
+
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 
+#include <cmath>
+#include <numbers>
+#include <vector>
+
 TEMPLATE_PRODUCT_TEST_CASE("neo/fft: dct2_plan", "", (neo::fft::fallback_dct2_plan), (float, double))
 {
     using Plan  = TestType;
@@ -37,3 +44,120 @@ TEMPLATE_PRODUCT_TEST_CASE("neo/fft: dct2_plan", "", (neo::fft::fallback_dct2_pl
         REQUIRE(x[7] == Catch::Approx(-0.20280929));
     }
 }
+
+namespace {
+
+template<typename Float>
+auto reference_dct(std::vector<Float> const& x, int type) -> std::vector<Float>
+{
+    auto const n  = x.size();
+    auto const pi = std::numbers::pi;
+    auto y        = std::vector<Float>(n);
+
+    for (auto k{0zu}; k < n; ++k) {
+        auto sum = 0.0;
+        for (auto i{0zu}; i < n; ++i) {
+            auto const xi = static_cast<double>(x[i]);
+            auto const ni = static_cast<double>(i);
+            auto const nk = static_cast<double>(k);
+            auto const nn = static_cast<double>(n);
+            if (type == 2) {
+                sum += 2.0 * xi * std::cos(pi * nk * (2.0 * ni + 1.0) / (2.0 * nn));
+            } else if (type == 3) {
+                sum += i == 0 ? xi : 2.0 * xi * std::cos(pi * ni * (2.0 * nk + 1.0) / (2.0 * nn));
+            } else {
+                sum += 2.0 * xi * std::cos(pi * (2.0 * ni + 1.0) * (2.0 * nk + 1.0) / (4.0 * nn));
+            }
+        }
+        y[k] = static_cast<Float>(sum);
+    }
+
+    return y;
+}
+
+}  // namespace
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/fft: dct_plan",
+    "",
+    (neo::fft::dct2_plan, neo::fft::dct3_plan, neo::fft::dct4_plan),
+    (float, double)
+)
+{
+    using Plan  = TestType;
+    using Float = typename Plan::value_type;
+
+    auto const type = [] {
+        if constexpr (std::same_as<Plan, neo::fft::dct2_plan<Float>>) {
+            return 2;
+        } else if constexpr (std::same_as<Plan, neo::fft::dct3_plan<Float>>) {
+            return 3;
+        } else {
+            return 4;
+        }
+    }();
+
+    auto const order = GENERATE(as<std::size_t>{}, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10);
+    CAPTURE(order);
+
+    auto plan = Plan{neo::fft::from_order, order};
+    REQUIRE(plan.order() == order);
+    REQUIRE(plan.size() == neo::ipow<2zu>(order));
+
+    auto const noise = neo::generate_noise_signal<Float>(plan.size(), Catch::getSeed());
+    auto const input = std::vector<Float>(noise.data(), noise.data() + noise.size());
+    auto const tol   = std::same_as<Float, float> ? 1e-4 * static_cast<double>(plan.size()) : 1e-9;
+
+    auto expected = reference_dct(input, type);
+    auto actual   = input;
+    plan(stdex::mdspan{actual.data(), stdex::extents{actual.size()}});
+
+    for (auto i{0zu}; i < actual.size(); ++i) {
+        CAPTURE(i);
+        REQUIRE(actual[i] == Catch::Approx(expected[i]).margin(tol));
+    }
+
+    // Batched rows match the single vector version
+    auto matrix = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{3zu, plan.size()};
+    for (auto row{0zu}; row < matrix.extent(0); ++row) {
+        for (auto i{0zu}; i < plan.size(); ++i) {
+            matrix(row, i) = input[i];
+        }
+    }
+    plan(matrix.to_mdspan());
+    for (auto row{0zu}; row < matrix.extent(0); ++row) {
+        for (auto i{0zu}; i < plan.size(); ++i) {
+            REQUIRE(matrix(row, i) == actual[i]);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/fft: dct_plan(inverse)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const order = GENERATE(as<std::size_t>{}, 1, 4, 9);
+    CAPTURE(order);
+
+    auto dct2 = neo::fft::dct2_plan<Float>{neo::fft::from_order, order};
+    auto dct3 = neo::fft::dct3_plan<Float>{neo::fft::from_order, order};
+    auto dct4 = neo::fft::dct4_plan<Float>{neo::fft::from_order, order};
+
+    auto const size  = dct2.size();
+    auto const scale = Float(1) / static_cast<Float>(size * 2zu);
+    auto const noise = neo::generate_noise_signal<Float>(size, Catch::getSeed());
+
+    auto x = noise;
+    dct2(x.to_mdspan());
+    dct3(x.to_mdspan());
+    for (auto i{0zu}; i < size; ++i) {
+        REQUIRE(x(i) * scale == Catch::Approx(noise(i)).margin(0.0001));
+    }
+
+    auto y = noise;
+    dct4(y.to_mdspan());
+    dct4(y.to_mdspan());
+    for (auto i{0zu}; i < size; ++i) {
+        REQUIRE(y(i) * scale == Catch::Approx(noise(i)).margin(0.0001));
+    }
+}
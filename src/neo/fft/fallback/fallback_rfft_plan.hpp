@@ -5,9 +5,12 @@
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/fft/fft.hpp>
+#include <neo/fft/norm.hpp>
 #include <neo/fft/order.hpp>
 #include <neo/math/conj.hpp>
 
+#include <cmath>
+
 namespace neo::fft {
 
 /// \ingroup neo-fft
@@ -18,10 +21,15 @@ struct fallback_rfft_plan
     using complex_type = Complex;
     using size_type    = std::size_t;
 
-    fallback_rfft_plan(from_order_tag /*tag*/, size_type order) : _order{order} {}
+    fallback_rfft_plan(from_order_tag /*tag*/, size_type order, fft::norm norm = fft::norm::none)
+        : _order{order}
+        , _norm{norm}
+    {}
 
     [[nodiscard]] auto order() const noexcept -> size_type { return _order; }
 
+    [[nodiscard]] auto norm() const noexcept -> fft::norm { return _norm; }
+
     [[nodiscard]] auto size() const noexcept -> size_type { return neo::ipow<2zu>(order()); }
 
     template<in_vector_of<Float> InVec, out_vector_of<Complex> OutVec>
@@ -32,7 +40,15 @@ struct fallback_rfft_plan
 
         copy(in, buf);
         _fft(buf, direction::forward);
-        copy(stdex::submdspan(buf, std::tuple{0ULL, coeffs}), stdex::submdspan(out, std::tuple{0ULL, coeffs}));
+
+        if (_norm == fft::norm::forward or _norm == fft::norm::ortho) {
+            auto const factor = scale_factor();
+            for (auto i{0UL}; i < coeffs; ++i) {
+                out[i] = buf[i] * factor;
+            }
+        } else {
+            copy(stdex::submdspan(buf, std::tuple{0ULL, coeffs}), stdex::submdspan(out, std::tuple{0ULL, coeffs}));
+        }
     }
 
     template<in_vector_of<Complex> InVec, out_vector_of<Float> OutVec>
@@ -49,13 +65,28 @@ struct fallback_rfft_plan
         }
 
         _fft(buf, direction::backward);
-        for (auto i{0UL}; i < size(); ++i) {
-            out[i] = buf[i].real();
+
+        if (_norm == fft::norm::backward or _norm == fft::norm::ortho) {
+            auto const factor = scale_factor();
+            for (auto i{0UL}; i < size(); ++i) {
+                out[i] = buf[i].real() * factor;
+            }
+        } else {
+            for (auto i{0UL}; i < size(); ++i) {
+                out[i] = buf[i].real();
+            }
         }
     }
 
 private:
+    [[nodiscard]] auto scale_factor() const noexcept -> Float
+    {
+        auto const n = static_cast<Float>(size());
+        return _norm == fft::norm::ortho ? Float(1) / std::sqrt(n) : Float(1) / n;
+    }
+
     size_type _order;
+    fft::norm _norm;
     fft_plan<Complex> _fft{from_order, _order};
     stdex::mdarray<Complex, stdex::dextents<size_type, 1>> _buffer{size()};
 };
@@ -21,6 +21,8 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <numbers>
 #include <random>
 #include <vector>
 
@@ -253,6 +255,43 @@ TEMPLATE_TEST_CASE(
 }
 #endif
 
+TEMPLATE_TEST_CASE("neo/fft: fill_twiddle_lut_radix2", "", neo::complex64, std::complex<float>, std::complex<double>)
+{
+    using Complex = TestType;
+
+    auto const size = GENERATE(as<std::size_t>{}, 2, 16, 1024);
+    auto const dir  = GENERATE(neo::fft::direction::forward, neo::fft::direction::backward);
+    auto const lut  = neo::fft::make_twiddle_lut_radix2<Complex>(size, dir);
+    REQUIRE(lut.extent(0) == size / 2);
+
+    for (auto i{0zu}; i < lut.extent(0); ++i) {
+        auto const expected = neo::fft::twiddle<std::complex<double>>(size, i, dir);
+        REQUIRE_THAT(lut(i).real(), Catch::Matchers::WithinAbs(expected.real(), 1e-6));
+        REQUIRE_THAT(lut(i).imag(), Catch::Matchers::WithinAbs(expected.imag(), 1e-6));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/fft: fill_chirp", "", neo::complex64, std::complex<float>, std::complex<double>)
+{
+    using Complex = TestType;
+
+    auto const size  = GENERATE(as<std::size_t>{}, 1, 3, 63, 64, 65, 1000);
+    auto const start = GENERATE(0.0, 0.125);
+    auto const sign  = GENERATE(-1.0, 1.0);
+    auto const step  = sign / static_cast<double>(size);
+
+    auto chirp = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{size};
+    neo::fft::fill_chirp(chirp.to_mdspan(), start, step);
+
+    for (auto i{0zu}; i < size; ++i) {
+        // i^2 mod 2N keeps the reference angle exact
+        auto const square = static_cast<double>((i * i) % (size * 2));
+        auto const angle  = -std::numbers::pi * (2.0 * start * static_cast<double>(i) + square * step);
+        REQUIRE_THAT(chirp(i).real(), Catch::Matchers::WithinAbs(std::cos(angle), 1e-6));
+        REQUIRE_THAT(chirp(i).imag(), Catch::Matchers::WithinAbs(std::sin(angle), 1e-6));
+    }
+}
+
 TEMPLATE_TEST_CASE("neo/fft: fft_plan", "", neo::complex64, std::complex<float>, neo::complex128, std::complex<double>)
 {
     test_fft_plan<neo::fft::fft_plan<TestType>>();
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/complex/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/math/sincos.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <numbers>
+#include <utility>
+#include <vector>
+
+namespace neo::fft {
+
+/// A few bins of the DFT of a block with the Goertzel recurrence.
+///
+/// Every bin costs one multiply and two adds per sample. The recurrences of all bins run
+/// side by side, so the loop over the bins vectorizes. A rfft_plan of size N spends about
+/// log2(N) operations per sample on all bins, but with the bins in SIMD lanes the break-even
+/// is far above log2(N) bins: 64 bins of N = 4096 take about a sixth of the time of the real
+/// transform (extra/benchmark/src/goertzel.cpp). Bins don't have to be integers,
+/// bin * sample_rate / size() is the frequency. For integer bins the output matches the DFT,
+/// X[k] = sum x[n] * exp(-2i * pi * k * n / N).
+///
+/// \ingroup neo-fft
+template<std::floating_point Float, complex Complex = std::complex<Float>>
+struct goertzel_plan
+{
+    using real_type    = Float;
+    using complex_type = Complex;
+    using size_type    = std::size_t;
+
+    template<in_vector InVec>
+        requires std::convertible_to<value_type_t<InVec>, Float>
+    goertzel_plan(size_type size, InVec bins);
+
+    [[nodiscard]] auto size() const noexcept -> size_type { return _size; }
+
+    [[nodiscard]] auto num_bins() const noexcept -> size_type { return _bins.size(); }
+
+    [[nodiscard]] auto bin(size_type index) const noexcept -> Float { return _bins[index]; }
+
+    template<in_vector InVec, out_vector OutVec>
+        requires(std::convertible_to<value_type_t<InVec>, Float> and std::same_as<value_type_t<OutVec>, Complex>)
+    auto operator()(InVec x, OutVec out) noexcept -> void;
+
+    /// Transforms every row, channels x size() to channels x num_bins()
+    template<in_matrix InMat, out_matrix OutMat>
+        requires(std::convertible_to<value_type_t<InMat>, Float> and std::same_as<value_type_t<OutMat>, Complex>)
+    auto operator()(InMat x, OutMat out) noexcept -> void
+    {
+        assert(x.extent(0) == out.extent(0));
+        for (auto ch{0zu}; ch < x.extent(0); ++ch) {
+            (*this)(stdex::submdspan(x, ch, stdex::full_extent), stdex::submdspan(out, ch, stdex::full_extent));
+        }
+    }
+
+private:
+    size_type _size;
+    std::vector<Float> _bins;
+    std::vector<Float> _coefficients;
+    std::vector<Complex> _first;
+    std::vector<Complex> _second;
+    std::vector<Float> _s1;
+    std::vector<Float> _s2;
+};
+
+template<std::floating_point Float, complex Complex>
+template<in_vector InVec>
+    requires std::convertible_to<value_type_t<InVec>, Float>
+goertzel_plan<Float, Complex>::goertzel_plan(size_type size, InVec bins)
+    : _size{size}
+    , _bins(bins.extent(0))
+    , _coefficients(bins.extent(0))
+    , _first(bins.extent(0))
+    , _second(bins.extent(0))
+    , _s1(bins.extent(0))
+    , _s2(bins.extent(0))
+{
+    assert(size > 0);
+
+    for (auto k{0zu}; k < num_bins(); ++k) {
+        _bins[k] = static_cast<Float>(bins[k]);
+
+        // X = exp(-iw(N - 1)) * (s[N - 1] - exp(-iw) * s[N - 2]), with exp(-iwN) = exp(-2i * pi * fract(bin))
+        auto const bin      = static_cast<double>(bins[k]);
+        auto const omega    = std::numbers::pi * 2.0 * bin / static_cast<double>(size);
+        auto const fraction = std::numbers::pi * 2.0 * (bin - std::floor(bin));
+        auto const [s1, c1] = fast_sincos(omega - fraction);
+        auto const [s2, c2] = fast_sincos(-fraction);
+
+        _coefficients[k] = static_cast<Float>(2.0 * std::cos(omega));
+        _first[k]        = Complex{static_cast<Float>(c1), static_cast<Float>(s1)};
+        _second[k]       = Complex{static_cast<Float>(c2), static_cast<Float>(s2)};
+    }
+}
+
+template<std::floating_point Float, complex Complex>
+template<in_vector InVec, out_vector OutVec>
+    requires(std::convertible_to<value_type_t<InVec>, Float> and std::same_as<value_type_t<OutVec>, Complex>)
+auto goertzel_plan<Float, Complex>::operator()(InVec x, OutVec out) noexcept -> void
+{
+    assert(std::cmp_equal(x.extent(0), size()));
+    assert(std::cmp_equal(out.extent(0), num_bins()));
+
+    auto const num_bins        = _bins.size();
+    auto const* NEO_RESTRICT c = _coefficients.data();
+    auto* NEO_RESTRICT s1      = _s1.data();
+    auto* NEO_RESTRICT s2      = _s2.data();
+
+    for (auto k{0zu}; k < num_bins; ++k) {
+        s1[k] = Float(0);
+        s2[k] = Float(0);
+    }
+
+    // s[n] = x[n] + 2 * cos(w) * s[n - 1] - s[n - 2]
+    for (auto n{0zu}; n < size(); ++n) {
+        auto const sample = static_cast<Float>(x[n]);
+        for (auto k{0zu}; k < num_bins; ++k) {
+            auto const s0 = sample + c[k] * s1[k] - s2[k];
+            s2[k]         = s1[k];
+            s1[k]         = s0;
+        }
+    }
+
+    for (auto k{0zu}; k < num_bins; ++k) {
+        auto const a = _first[k];
+        auto const b = _second[k];
+        out[k]       = Complex{a.real() * s1[k] - b.real() * s2[k], a.imag() * s1[k] - b.imag() * s2[k]};
+    }
+}
+
+}  // namespace neo::fft
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT
+
+#include "goertzel.hpp"
+
+#include <neo/complex/scalar_complex.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <vector>
+
+namespace {
+
+template<typename Float>
+auto dft_bin(std::vector<Float> const& x, double bin) -> std::complex<double>
+{
+    auto sum = std::complex<double>{};
+    for (auto n{0zu}; n < x.size(); ++n) {
+        auto const angle = -std::numbers::pi * 2.0 * bin * static_cast<double>(n) / static_cast<double>(x.size());
+        sum += static_cast<double>(x[n]) * std::polar(1.0, angle);
+    }
+    return sum;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/fft: goertzel_plan", "", std::complex<float>, std::complex<double>, neo::complex128)
+{
+    using Complex = TestType;
+    using Float   = typename Complex::value_type;
+
+    auto const size = GENERATE(as<std::size_t>{}, 64, 256, 1000);
+    CAPTURE(size);
+
+    // Integer, fractional, DC & nyquist bins
+    auto const bins = std::vector<Float>{Float(0), Float(1), Float(3), Float(17.5), Float(31.25), Float(32)};
+    auto plan       = neo::fft::goertzel_plan<Float, Complex>{size, stdex::mdspan{bins.data(), stdex::extents{6zu}}};
+    REQUIRE(plan.size() == size);
+    REQUIRE(plan.num_bins() == bins.size());
+    REQUIRE(plan.bin(3) == Float(17.5));
+
+    auto const noise = neo::generate_noise_signal<Float>(size * 2zu, Catch::getSeed());
+    auto signal      = std::vector<Float>(size * 2zu);
+    for (auto i{0zu}; i < signal.size(); ++i) {
+        signal[i] = noise(i);
+    }
+
+    auto const tolerance = std::same_as<Float, float> ? 1e-3 : 1e-9;
+    auto const x         = stdex::mdspan{signal.data(), stdex::extents{2zu, size}};
+    auto out             = stdex::mdarray<Complex, stdex::dextents<std::size_t, 2>>{2zu, bins.size()};
+    plan(x, out.to_mdspan());
+
+    for (auto ch{0zu}; ch < 2zu; ++ch) {
+        auto const first   = std::next(signal.begin(), static_cast<std::ptrdiff_t>(ch * size));
+        auto const channel = std::vector<Float>(first, std::next(first, static_cast<std::ptrdiff_t>(size)));
+        for (auto k{0zu}; k < bins.size(); ++k) {
+            auto const expected = dft_bin(channel, static_cast<double>(bins[k]));
+            REQUIRE_THAT(out(ch, k).real(), Catch::Matchers::WithinAbs(expected.real(), tolerance * double(size)));
+            REQUIRE_THAT(out(ch, k).imag(), Catch::Matchers::WithinAbs(expected.imag(), tolerance * double(size)));
+        }
+    }
+}
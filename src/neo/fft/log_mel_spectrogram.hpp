@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/complex/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fft/fft.hpp>
+#include <neo/fft/mel_filterbank.hpp>
+#include <neo/fft/rfft.hpp>
+#include <neo/fft/stft.hpp>
+#include <neo/math/windowing.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <stdexcept>
+#include <utility>
+
+namespace neo::fft {
+
+/// Fused STFT -> power -> mel -> log feature extraction.
+///
+/// Each frame goes through the whole chain while it is still in cache, only the
+/// channels x frames x mels result is written to memory. Pairs of frames share one
+/// complex transform, like in stft_plan. The output is log(max(mel, floor)).
+///
+/// \ingroup neo-fft
+template<std::floating_point Float, complex Complex = std::complex<Float>>
+struct log_mel_spectrogram_plan
+{
+    using real_type    = Float;
+    using complex_type = Complex;
+    using size_type    = std::size_t;
+
+    /// Throws std::invalid_argument if the filterbank doesn't match the number of bins of the transform
+    log_mel_spectrogram_plan(stft_options<Float> options, mel_filterbank<Float> filterbank, Float floor = Float(1e-10));
+
+    [[nodiscard]] auto num_mels() const noexcept -> size_type { return _filterbank.num_mels(); }
+
+    [[nodiscard]] auto num_frames(size_type signal_size) const noexcept -> size_type
+    {
+        return detail::num_sftf_frames(signal_size, _options.frame_size, _options.overlap_size);
+    }
+
+    [[nodiscard]] auto filterbank() const noexcept -> mel_filterbank<Float> const& { return _filterbank; }
+
+    template<in_matrix InMat>
+        requires std::convertible_to<value_type_t<InMat>, Float>
+    [[nodiscard]] auto operator()(InMat x)
+    {
+        auto const channels = static_cast<size_type>(x.extent(0));
+        auto const frames   = num_frames(x.extent(1));
+        auto result         = stdex::mdarray<Float, stdex::dextents<size_type, 3>>{channels, frames, num_mels()};
+        (*this)(x, result.to_mdspan());
+        return result;
+    }
+
+    /// Writes into a channels x num_frames() x num_mels() output without allocating
+    template<in_matrix InMat, typename OutTensor>
+        requires(std::convertible_to<value_type_t<InMat>, Float> and is_mdspan<OutTensor> and OutTensor::rank() == 3)
+    auto operator()(InMat x, OutTensor out) -> void;
+
+private:
+    stft_options<Float> _options;
+    mel_filterbank<Float> _filterbank;
+    Float _floor;
+
+    rfft_plan<Float, Complex> _rfft;
+    fft_plan<Complex> _fft{from_order, _rfft.order()};
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _window{_options.frame_size};
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _input{_rfft.size()};
+    stdex::mdarray<Complex, stdex::dextents<size_type, 1>> _buffer{_rfft.size()};
+    stdex::mdarray<Complex, stdex::dextents<size_type, 2>> _spectra{2zu, _rfft.size() / 2zu + 1zu};
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _power{_rfft.size() / 2zu + 1zu};
+};
+
+template<std::floating_point Float, complex Complex>
+log_mel_spectrogram_plan<Float, Complex>::log_mel_spectrogram_plan(
+    stft_options<Float> options,
+    mel_filterbank<Float> filterbank,
+    Float floor
+)
+    : _options{std::move(options)}
+    , _filterbank{std::move(filterbank)}
+    , _floor{floor}
+    , _rfft{from_order, next_order(std::max(_options.transform_size, _options.frame_size))}
+{
+    if (_options.frame_size == 0 or _options.overlap_size >= _options.frame_size) {
+        throw std::invalid_argument{"log_mel_spectrogram_plan: overlap_size must be less than frame_size"};
+    }
+    if (_filterbank.num_bins() != _power.extent(0)) {
+        throw std::invalid_argument{"log_mel_spectrogram_plan: filterbank doesn't match the transform size"};
+    }
+
+    fill_window(_window.to_mdspan(), _options.window);
+}
+
+template<std::floating_point Float, complex Complex>
+template<in_matrix InMat, typename OutTensor>
+    requires(std::convertible_to<value_type_t<InMat>, Float> and is_mdspan<OutTensor> and OutTensor::rank() == 3)
+auto log_mel_spectrogram_plan<Float, Complex>::operator()(InMat x, OutTensor out) -> void
+{
+    assert(out.extent(0) == x.extent(0));
+    assert(out.extent(1) == num_frames(x.extent(1)));
+    assert(out.extent(2) == num_mels());
+
+    auto const hop        = _options.frame_size - _options.overlap_size;
+    auto const signal_len = static_cast<size_type>(x.extent(1));
+    auto const window     = _window.to_mdspan();
+    auto const spectra    = _spectra.to_mdspan();
+    auto const power      = _power.to_mdspan();
+    auto const num_bins   = power.extent(0);
+    auto const frames     = static_cast<size_type>(out.extent(1));
+
+    auto const frame_length = [&](size_type frame) {
+        return std::min(signal_len - frame * hop, _options.frame_size);
+    };
+
+    auto const to_log_mel = [&](size_type row, auto mels) {
+        for (auto k{0zu}; k < num_bins; ++k) {
+            auto const bin = spectra(row, k);
+            power[k]       = bin.real() * bin.real() + bin.imag() * bin.imag();
+        }
+
+        _filterbank(power, mels);
+        for (auto mel{0zu}; mel < mels.extent(0); ++mel) {
+            mels[mel] = std::log(std::max(mels[mel], _floor));
+        }
+    };
+
+    for (auto ch{0zu}; ch < static_cast<size_type>(x.extent(0)); ++ch) {
+        auto frame = 0zu;
+
+        // Two real frames in the real & imaginary part of one complex transform
+        for (; frame + 1zu < frames; frame += 2zu) {
+            detail::stft_frame_pair<Float>(
+                _fft,
+                x,
+                ch,
+                frame * hop,
+                hop,
+                frame_length(frame),
+                frame_length(frame + 1zu),
+                window,
+                _buffer.to_mdspan(),
+                stdex::submdspan(spectra, 0zu, stdex::full_extent),
+                stdex::submdspan(spectra, 1zu, stdex::full_extent)
+            );
+
+            to_log_mel(0zu, stdex::submdspan(out, ch, frame, stdex::full_extent));
+            to_log_mel(1zu, stdex::submdspan(out, ch, frame + 1zu, stdex::full_extent));
+        }
+
+        if (frame < frames) {
+            auto const input    = _input.to_mdspan();
+            auto const spectrum = stdex::submdspan(spectra, 0zu, stdex::full_extent);
+            detail::stft_frame<Float>(_rfft, x, ch, frame * hop, frame_length(frame), window, input, spectrum);
+            to_log_mel(0zu, stdex::submdspan(out, ch, frame, stdex::full_extent));
+        }
+    }
+}
+
+}  // namespace neo::fft
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: MIT
+
+#include "log_mel_spectrogram.hpp"
+
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <stdexcept>
+
+TEMPLATE_TEST_CASE("neo/fft: log_mel_spectrogram_plan", "", float, double)
+{
+    using Float = TestType;
+
+    auto const num_channels = GENERATE(as<std::size_t>{}, 1, 2);
+    auto const num_samples  = GENERATE(as<std::size_t>{}, 400, 4000, 4321);
+    auto const frame_size   = GENERATE(as<std::size_t>{}, 256, 400);
+    CAPTURE(num_channels);
+    CAPTURE(num_samples);
+    CAPTURE(frame_size);
+
+    auto const options = neo::fft::stft_options<Float>{
+        .frame_size     = frame_size,
+        .transform_size = 512,
+        .overlap_size   = frame_size - 160zu,
+    };
+    auto const bank = neo::fft::mel_filterbank<Float>{40, 257, Float(16000), Float(0), Float(8000)};
+
+    auto plan = neo::fft::log_mel_spectrogram_plan<Float>{options, bank};
+    REQUIRE(plan.num_mels() == 40);
+    REQUIRE(plan.filterbank().num_bins() == 257);
+
+    auto const noise  = neo::generate_noise_signal<Float>(num_channels * num_samples, Catch::getSeed());
+    auto const signal = stdex::mdspan{noise.data(), stdex::extents{num_channels, num_samples}};
+    auto const result = plan(signal);
+    REQUIRE(result.extent(0) == num_channels);
+    REQUIRE(result.extent(1) == plan.num_frames(num_samples));
+    REQUIRE(result.extent(2) == plan.num_mels());
+
+    // Same as stft -> power -> mel -> log in separate passes
+    auto stft           = neo::fft::stft_plan<Float>{options};
+    auto const spectrum = stft(signal);
+    REQUIRE(spectrum.extent(1) == result.extent(1));
+
+    auto power = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{257zu};
+    auto mels  = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{40zu};
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        for (auto frame{0zu}; frame < result.extent(1); ++frame) {
+            for (auto bin{0zu}; bin < power.extent(0); ++bin) {
+                power(bin) = std::norm(spectrum(ch, frame, bin));
+            }
+            bank(power.to_mdspan(), mels.to_mdspan());
+
+            for (auto mel{0zu}; mel < mels.extent(0); ++mel) {
+                auto const expected = std::log(std::max(mels(mel), Float(1e-10)));
+                REQUIRE_THAT(result(ch, frame, mel), Catch::Matchers::WithinAbs(expected, 0.001));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/fft: log_mel_spectrogram_plan(invalid)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const options = neo::fft::stft_options<Float>{.frame_size = 512, .transform_size = 512, .overlap_size = 256};
+    auto const bank    = neo::fft::mel_filterbank<Float>{40, 513, Float(16000), Float(0), Float(8000)};
+
+    REQUIRE_THROWS_AS((neo::fft::log_mel_spectrogram_plan<Float>{options, bank}), std::invalid_argument);
+}
@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/algorithm/fill.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fft/dct.hpp>
+#include <neo/fft/order.hpp>
+#include <neo/math/windowing.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace neo::fft {
+
+/// Modified discrete cosine transform, 2N samples to N coefficients.
+///
+/// Both directions fold the frame into a N point DCT-IV. The forward transform is
+/// unnormalized, the inverse is scaled by 1/N, so overlap-adding the inverse of
+/// consecutive frames with hop N cancels the time domain aliasing (TDAC).
+///
+/// \ingroup neo-fft
+template<std::floating_point Float>
+struct mdct_plan
+{
+    using value_type = Float;
+    using size_type  = std::size_t;
+
+    /// size() == 2^order coefficients, order must be at least 1
+    mdct_plan(from_order_tag tag, size_type order) : _dct{tag, order}, _buffer{_dct.size()} {}
+
+    [[nodiscard]] auto order() const noexcept -> size_type { return _dct.order(); }
+
+    /// Number of coefficients
+    [[nodiscard]] auto size() const noexcept -> size_type { return _dct.size(); }
+
+    /// Number of samples
+    [[nodiscard]] auto frame_size() const noexcept -> size_type { return _dct.size() * 2zu; }
+
+    /// X[k] = sum x[n] * cos(pi/N * (n + 1/2 + N/2) * (k + 1/2))
+    template<in_vector InVec, out_vector OutVec>
+        requires(std::floating_point<value_type_t<InVec>> and std::same_as<value_type_t<OutVec>, Float>)
+    auto forward(InVec in, OutVec out) noexcept -> void;
+
+    /// y[n] = 1/N * sum X[k] * cos(pi/N * (n + 1/2 + N/2) * (k + 1/2))
+    template<in_vector InVec, out_vector OutVec>
+        requires(std::floating_point<value_type_t<InVec>> and std::same_as<value_type_t<OutVec>, Float>)
+    auto inverse(InVec in, OutVec out) noexcept -> void;
+
+private:
+    dct4_plan<Float> _dct;
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _buffer;
+};
+
+template<std::floating_point Float>
+template<in_vector InVec, out_vector OutVec>
+    requires(std::floating_point<value_type_t<InVec>> and std::same_as<value_type_t<OutVec>, Float>)
+auto mdct_plan<Float>::forward(InVec in, OutVec out) noexcept -> void
+{
+    auto const n    = size();
+    auto const half = n / 2zu;
+    assert(std::cmp_equal(in.extent(0), frame_size()));
+    assert(std::cmp_equal(out.extent(0), n));
+
+    // Split into quarters (a, b, c, d) and fold to (-c_r - d, a - b_r)
+    for (auto i{0zu}; i < half; ++i) {
+        auto const c = static_cast<Float>(in[n + half - 1zu - i]);
+        auto const d = static_cast<Float>(in[n + half + i]);
+        out[i]       = (-c - d) * Float(0.5);
+    }
+    for (auto i{0zu}; i < half; ++i) {
+        auto const a  = static_cast<Float>(in[i]);
+        auto const b  = static_cast<Float>(in[n - 1zu - i]);
+        out[half + i] = (a - b) * Float(0.5);
+    }
+
+    // dct4_plan is scaled by 2, which the fold above compensates
+    _dct(out);
+}
+
+template<std::floating_point Float>
+template<in_vector InVec, out_vector OutVec>
+    requires(std::floating_point<value_type_t<InVec>> and std::same_as<value_type_t<OutVec>, Float>)
+auto mdct_plan<Float>::inverse(InVec in, OutVec out) noexcept -> void
+{
+    auto const n      = size();
+    auto const half   = n / 2zu;
+    auto const buffer = _buffer.to_mdspan();
+    assert(std::cmp_equal(in.extent(0), n));
+    assert(std::cmp_equal(out.extent(0), frame_size()));
+
+    auto const scale = Float(0.5) / static_cast<Float>(n);
+    for (auto i{0zu}; i < n; ++i) {
+        buffer[i] = static_cast<Float>(in[i]) * scale;
+    }
+    _dct(buffer);
+
+    // Unfold (w1, w2) to (w2, -w2_r, -w1_r, -w1)
+    for (auto i{0zu}; i < half; ++i) {
+        out[i]                  = buffer[half + i];
+        out[n - 1zu - i]        = -buffer[half + i];
+        out[n + half - 1zu - i] = -buffer[i];
+        out[n + half + i]       = -buffer[i];
+    }
+}
+
+/// \ingroup neo-fft
+template<typename Plan, in_vector InVec, out_vector OutVec>
+auto mdct(Plan& plan, InVec input, OutVec output) -> void
+{
+    plan.forward(input, output);
+}
+
+/// \ingroup neo-fft
+template<typename Plan, in_vector InVec, out_vector OutVec>
+auto imdct(Plan& plan, InVec input, OutVec output) -> void
+{
+    plan.inverse(input, output);
+}
+
+/// Streaming MDCT -> IMDCT with TDAC overlap-add resynthesis.
+///
+/// Accepts chunks of any size. Every size() samples a frame of 2 * size() samples is
+/// windowed, transformed and handed to the callback as a channels x size() matrix of
+/// coefficients, which may be modified in place. The same window is applied after the
+/// inverse transform, so it must satisfy the Princen-Bradley condition. Unmodified
+/// coefficients reconstruct the input exactly, delayed by latency() samples. All buffers
+/// are allocated in the constructor.
+///
+/// \ingroup neo-fft
+template<std::floating_point Float>
+struct mdct_processor
+{
+    using real_type = Float;
+    using size_type = std::size_t;
+
+    /// Throws std::invalid_argument if w[n]^2 + w[n + N]^2 != 1 or the window isn't symmetric
+    template<typename Window = sine_window<Float>>
+    mdct_processor(size_type num_channels, size_type order, Window const& window = Window{});
+
+    [[nodiscard]] auto num_channels() const noexcept -> size_type { return _input.extent(0); }
+
+    [[nodiscard]] auto size() const noexcept -> size_type { return _mdct.size(); }
+
+    [[nodiscard]] auto frame_size() const noexcept -> size_type { return _mdct.frame_size(); }
+
+    [[nodiscard]] auto latency() const noexcept -> size_type { return frame_size(); }
+
+    [[nodiscard]] auto window() const noexcept { return _window.to_mdspan(); }
+
+    auto reset() -> void;
+
+    /// Calls process(coefficients) with a channels x size() inout_matrix for every completed frame
+    template<inout_matrix InOutMat, typename Processor>
+        requires std::invocable<Processor&, stdex::mdspan<Float, stdex::dextents<size_type, 2>>>
+    auto operator()(InOutMat io, Processor&& process) -> void;
+
+private:
+    auto process_frame(auto& process) -> void;
+
+    size_type _position{0};
+
+    mdct_plan<Float> _mdct;
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _window;
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _buffer;
+
+    stdex::mdarray<Float, stdex::dextents<size_type, 2>> _input;
+    stdex::mdarray<Float, stdex::dextents<size_type, 2>> _output;
+    stdex::mdarray<Float, stdex::dextents<size_type, 2>> _coefficients;
+};
+
+template<std::floating_point Float>
+template<typename Window>
+mdct_processor<Float>::mdct_processor(size_type num_channels, size_type order, Window const& window)
+    : _mdct{from_order, order}
+    , _window{_mdct.frame_size()}
+    , _buffer{_mdct.frame_size()}
+    , _input{num_channels, _mdct.frame_size()}
+    , _output{num_channels, _mdct.frame_size()}
+    , _coefficients{num_channels, _mdct.size()}
+{
+    fill_window(_window.to_mdspan(), window);
+
+    auto const n         = size();
+    auto const tolerance = std::sqrt(std::numeric_limits<Float>::epsilon()) * Float(4);
+    for (auto i{0zu}; i < n; ++i) {
+        auto const w0 = _window(i);
+        auto const w1 = _window(i + n);
+        auto const wr = _window(n * 2zu - 1zu - i);
+        if (std::abs(w0 * w0 + w1 * w1 - Float(1)) > tolerance or std::abs(w0 - wr) > tolerance) {
+            throw std::invalid_argument{"mdct_processor: window does not satisfy the Princen-Bradley condition"};
+        }
+    }
+
+    reset();
+}
+
+template<std::floating_point Float>
+auto mdct_processor<Float>::reset() -> void
+{
+    fill(_input.to_mdspan(), Float(0));
+    fill(_output.to_mdspan(), Float(0));
+    _position = 0;
+}
+
+template<std::floating_point Float>
+template<inout_matrix InOutMat, typename Processor>
+    requires std::invocable<Processor&, stdex::mdspan<Float, stdex::dextents<std::size_t, 2>>>
+auto mdct_processor<Float>::operator()(InOutMat io, Processor&& process) -> void
+{
+    assert(io.extent(0) == num_channels());
+
+    auto const input  = _input.to_mdspan();
+    auto const output = _output.to_mdspan();
+    auto const hop    = size();
+
+    for (auto offset{0zu}; offset < io.extent(1);) {
+        auto const count = std::min(hop - _position, io.extent(1) - offset);
+        for (auto ch{0zu}; ch < num_channels(); ++ch) {
+            for (auto i{0zu}; i < count; ++i) {
+                input(ch, hop + _position + i) = static_cast<Float>(io(ch, offset + i));
+                io(ch, offset + i)             = output(ch, _position + i);
+            }
+        }
+
+        offset += count;
+        _position += count;
+
+        if (_position == hop) {
+            process_frame(process);
+            _position = 0;
+        }
+    }
+}
+
+template<std::floating_point Float>
+auto mdct_processor<Float>::process_frame(auto& process) -> void
+{
+    auto const input        = _input.to_mdspan();
+    auto const output       = _output.to_mdspan();
+    auto const coefficients = _coefficients.to_mdspan();
+    auto const buffer       = _buffer.to_mdspan();
+    auto const hop          = size();
+
+    for (auto ch{0zu}; ch < num_channels(); ++ch) {
+        for (auto i{0zu}; i < frame_size(); ++i) {
+            buffer[i] = input(ch, i) * _window(i);
+        }
+        mdct(_mdct, buffer, stdex::submdspan(coefficients, ch, stdex::full_extent));
+    }
+
+    process(coefficients);
+
+    for (auto ch{0zu}; ch < num_channels(); ++ch) {
+        imdct(_mdct, stdex::submdspan(coefficients, ch, stdex::full_extent), buffer);
+
+        // The aliasing in the first half cancels with the second half of the previous frame.
+        // With w[n]^2 + w[n + N]^2 == 1 the windowed overlap-add of the 1/N inverse yields x/2.
+        for (auto i{0zu}; i < hop; ++i) {
+            output(ch, i)       = output(ch, i + hop) + buffer[i] * _window(i) * Float(2);
+            output(ch, i + hop) = buffer[i + hop] * _window(i + hop) * Float(2);
+            input(ch, i)        = input(ch, i + hop);
+        }
+    }
+}
+
+}  // namespace neo::fft
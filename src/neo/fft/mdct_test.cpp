@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: MIT
+
+#include "mdct.hpp"
+
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+template<typename Float>
+auto mdct_basis(std::size_t n, std::size_t k, std::size_t size) -> Float
+{
+    auto const pi = std::numbers::pi_v<double>;
+    auto const nn = static_cast<double>(n) + 0.5 + static_cast<double>(size) / 2.0;
+    auto const kk = static_cast<double>(k) + 0.5;
+    return static_cast<Float>(std::cos(pi / static_cast<double>(size) * nn * kk));
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/fft: mdct_plan", "", float, double)
+{
+    using Float = TestType;
+
+    auto const order = GENERATE(as<std::size_t>{}, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10);
+    CAPTURE(order);
+
+    auto plan = neo::fft::mdct_plan<Float>{neo::fft::from_order, order};
+    auto const n = plan.size();
+    REQUIRE(plan.order() == order);
+    REQUIRE(n == neo::ipow<2zu>(order));
+    REQUIRE(plan.frame_size() == n * 2zu);
+
+    auto const tolerance = std::is_same_v<Float, float> ? 0.0005 : 0.00000001;
+    auto const signal    = neo::generate_noise_signal<Float>(n * 2zu, Catch::getSeed());
+    auto coefficients    = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{n};
+    neo::fft::mdct(plan, signal.to_mdspan(), coefficients.to_mdspan());
+
+    for (auto k{0zu}; k < n; ++k) {
+        auto expected = Float(0);
+        for (auto i{0zu}; i < n * 2zu; ++i) {
+            expected += signal(i) * mdct_basis<Float>(i, k, n);
+        }
+        REQUIRE_THAT(coefficients(k), Catch::Matchers::WithinAbs(expected, tolerance * static_cast<double>(n)));
+    }
+
+    auto output = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{n * 2zu};
+    neo::fft::imdct(plan, coefficients.to_mdspan(), output.to_mdspan());
+
+    for (auto i{0zu}; i < n * 2zu; ++i) {
+        auto expected = Float(0);
+        for (auto k{0zu}; k < n; ++k) {
+            expected += coefficients(k) * mdct_basis<Float>(i, k, n);
+        }
+        expected /= static_cast<Float>(n);
+        REQUIRE_THAT(output(i), Catch::Matchers::WithinAbs(expected, tolerance * static_cast<double>(n)));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/fft: mdct_processor", "", float, double)
+{
+    using Float = TestType;
+
+    auto const num_channels = GENERATE(as<std::size_t>{}, 1, 2);
+    auto const order        = GENERATE(as<std::size_t>{}, 1, 6, 9);
+    auto const use_kbd      = GENERATE(false, true);
+    CAPTURE(num_channels);
+    CAPTURE(order);
+    CAPTURE(use_kbd);
+
+    auto mdct = use_kbd ? neo::fft::mdct_processor<Float>{num_channels, order, neo::kbd_window<Float>{4}}
+                        : neo::fft::mdct_processor<Float>{num_channels, order};
+    REQUIRE(mdct.num_channels() == num_channels);
+    REQUIRE(mdct.size() == neo::ipow<2zu>(order));
+    REQUIRE(mdct.frame_size() == mdct.size() * 2zu);
+    REQUIRE(mdct.latency() == mdct.frame_size());
+    REQUIRE(mdct.window().extent(0) == mdct.frame_size());
+
+    auto const num_samples = 4000zu;
+    auto const noise       = neo::generate_noise_signal<Float>(num_channels * num_samples, Catch::getSeed());
+    auto const signal      = stdex::mdspan{noise.data(), stdex::extents{num_channels, num_samples}};
+    auto output            = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_channels, num_samples};
+    neo::copy(signal, output.to_mdspan());
+
+    // Unmodified coefficients reconstruct the delayed input, callback sizes are random
+    auto num_frames = 0zu;
+    auto rng        = std::mt19937{Catch::getSeed()};
+    auto dist       = std::uniform_int_distribution<std::size_t>{0, 700};
+    for (auto offset{0zu}; offset < num_samples;) {
+        auto const size = std::min(dist(rng), num_samples - offset);
+        auto const io   = stdex::submdspan(output.to_mdspan(), stdex::full_extent, std::tuple{offset, offset + size});
+        mdct(io, [&num_frames, &mdct](auto coefficients) {
+            REQUIRE(coefficients.extent(0) == mdct.num_channels());
+            REQUIRE(coefficients.extent(1) == mdct.size());
+            ++num_frames;
+        });
+        offset += size;
+    }
+
+    REQUIRE(num_frames == num_samples / mdct.size());
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        for (auto i{0zu}; i < num_samples; ++i) {
+            auto const expected = i < mdct.latency() ? Float(0) : signal(ch, i - mdct.latency());
+            REQUIRE_THAT(output(ch, i), Catch::Matchers::WithinAbs(expected, 0.0001));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/fft: mdct_processor(process)", "", float, double)
+{
+    using Float = TestType;
+
+    REQUIRE_THROWS_AS((neo::fft::mdct_processor<Float>{1, 8, neo::hann_window<Float>{}}), std::invalid_argument);
+
+    auto mdct        = neo::fft::mdct_processor<Float>{1, 8};
+    auto const noise = neo::generate_noise_signal<Float>(2048zu, Catch::getSeed());
+    auto block       = noise;
+    auto io          = stdex::mdspan{block.data(), stdex::extents{1zu, block.extent(0)}};
+
+    // Removing all coefficients silences the output
+    mdct(io, [](auto coefficients) { neo::fill(coefficients, Float(0)); });
+    for (auto i{0zu}; i < block.extent(0); ++i) {
+        REQUIRE(block(i) == Float(0));
+    }
+
+    mdct.reset();
+    neo::copy(noise.to_mdspan(), block.to_mdspan());
+    mdct(io, [](auto) {});
+    for (auto i{mdct.latency()}; i < block.extent(0); ++i) {
+        REQUIRE_THAT(block(i), Catch::Matchers::WithinAbs(noise(i - mdct.latency()), 0.0001));
+    }
+}
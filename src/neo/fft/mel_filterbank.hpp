@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/algorithm/dot.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/unit/mel.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace neo::fft {
+
+/// Triangular filters on the mel scale, applied to power (or magnitude) spectra.
+///
+/// Every filter is stored as the range of bins it covers, so applying the bank
+/// only touches the non-zero weights: roughly two multiply-adds per bin in total,
+/// instead of num_mels() per bin for a dense matrix. With normalize, every filter
+/// is scaled to unit area in hertz (slaney).
+///
+/// \ingroup neo-fft
+template<std::floating_point Float>
+struct mel_filterbank
+{
+    using value_type = Float;
+    using size_type  = std::size_t;
+
+    /// num_bins is transform_size / 2 + 1
+    mel_filterbank(
+        size_type num_mels,
+        size_type num_bins,
+        Float sample_rate,
+        Float fmin,
+        Float fmax,
+        bool normalize = true
+    );
+
+    [[nodiscard]] auto num_mels() const noexcept -> size_type { return _starts.size(); }
+
+    [[nodiscard]] auto num_bins() const noexcept -> size_type { return _num_bins; }
+
+    /// First bin with a non-zero weight
+    [[nodiscard]] auto start(size_type mel) const noexcept -> size_type { return _starts[mel]; }
+
+    /// Weights for the bins [start(mel), start(mel) + weights(mel).extent(0))
+    [[nodiscard]] auto weights(size_type mel) const noexcept
+    {
+        auto const offset = _offsets[mel];
+        return stdex::mdspan{_weights.data() + offset, stdex::extents{_offsets[mel + 1] - offset}};
+    }
+
+    template<in_vector InVec, out_vector OutVec>
+        requires(std::same_as<value_type_t<InVec>, Float> and std::same_as<value_type_t<OutVec>, Float>)
+    auto operator()(InVec spectrum, OutVec mels) const noexcept -> void;
+
+    /// Filters every row, frames x bins to frames x mels
+    template<in_matrix InMat, out_matrix OutMat>
+        requires(std::same_as<value_type_t<InMat>, Float> and std::same_as<value_type_t<OutMat>, Float>)
+    auto operator()(InMat spectra, OutMat mels) const noexcept -> void
+    {
+        assert(spectra.extent(0) == mels.extent(0));
+        for (auto row{0zu}; row < spectra.extent(0); ++row) {
+            auto const spectrum = stdex::submdspan(spectra, row, stdex::full_extent);
+            (*this)(spectrum, stdex::submdspan(mels, row, stdex::full_extent));
+        }
+    }
+
+private:
+    size_type _num_bins;
+    std::vector<size_type> _starts;
+    std::vector<size_type> _offsets;
+    std::vector<Float> _weights;
+};
+
+template<std::floating_point Float>
+mel_filterbank<Float>::mel_filterbank(
+    size_type num_mels,
+    size_type num_bins,
+    Float sample_rate,
+    Float fmin,
+    Float fmax,
+    bool normalize
+)
+    : _num_bins{num_bins}
+    , _starts(num_mels)
+    , _offsets(num_mels + 1zu)
+{
+    assert(num_bins > 1);
+    assert(fmin < fmax);
+
+    // Band edges, filter m rises from edges[m] to edges[m + 1] and falls to edges[m + 2]
+    auto edges = std::vector<Float>(num_mels + 2zu);
+    mel_frequencies(stdex::mdspan{edges.data(), stdex::extents{edges.size()}}, fmin, fmax);
+
+    auto const bin_width = sample_rate / static_cast<Float>((num_bins - 1zu) * 2zu);
+    auto const weight    = [&](size_type mel, size_type bin) {
+        auto const hertz   = static_cast<Float>(bin) * bin_width;
+        auto const lower   = (hertz - edges[mel]) / (edges[mel + 1zu] - edges[mel]);
+        auto const upper   = (edges[mel + 2zu] - hertz) / (edges[mel + 2zu] - edges[mel + 1zu]);
+        auto const scale   = normalize ? Float(2) / (edges[mel + 2zu] - edges[mel]) : Float(1);
+        auto const clamped = std::max(Float(0), std::min(lower, upper));
+        return clamped * scale;
+    };
+
+    for (auto mel{0zu}; mel < num_mels; ++mel) {
+        auto first = 0zu;
+        while (first < num_bins and weight(mel, first) <= Float(0)) {
+            ++first;
+        }
+        auto last = first;
+        while (last < num_bins and weight(mel, last) > Float(0)) {
+            ++last;
+        }
+
+        _starts[mel] = first;
+        for (auto bin{first}; bin < last; ++bin) {
+            _weights.push_back(weight(mel, bin));
+        }
+        _offsets[mel + 1zu] = _weights.size();
+    }
+}
+
+template<std::floating_point Float>
+template<in_vector InVec, out_vector OutVec>
+    requires(std::same_as<value_type_t<InVec>, Float> and std::same_as<value_type_t<OutVec>, Float>)
+auto mel_filterbank<Float>::operator()(InVec spectrum, OutVec mels) const noexcept -> void
+{
+    assert(std::cmp_equal(spectrum.extent(0), num_bins()));
+    assert(std::cmp_equal(mels.extent(0), num_mels()));
+
+    for (auto mel{0zu}; mel < num_mels(); ++mel) {
+        auto const first = _starts[mel];
+        auto const bins  = stdex::submdspan(spectrum, std::tuple{first, first + weights(mel).extent(0)});
+        mels[mel]        = dot(weights(mel), bins);
+    }
+}
+
+}  // namespace neo::fft
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MIT
+
+#include "mel_filterbank.hpp"
+
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <vector>
+
+TEMPLATE_TEST_CASE("neo/fft: mel_filterbank", "", float, double)
+{
+    using Float = TestType;
+
+    auto const num_mels    = GENERATE(as<std::size_t>{}, 1, 13, 40, 128);
+    auto const num_bins    = GENERATE(as<std::size_t>{}, 257, 1025);
+    auto const normalize   = GENERATE(false, true);
+    auto const sample_rate = Float(16000);
+    CAPTURE(num_mels);
+    CAPTURE(num_bins);
+    CAPTURE(normalize);
+
+    auto const bank = neo::fft::mel_filterbank<Float>{
+        num_mels,
+        num_bins,
+        sample_rate,
+        Float(20),
+        Float(8000),
+        normalize,
+    };
+    REQUIRE(bank.num_mels() == num_mels);
+    REQUIRE(bank.num_bins() == num_bins);
+
+    // Dense matrix of all filters, zero outside of each range
+    auto dense = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_mels, num_bins};
+    for (auto mel{0zu}; mel < num_mels; ++mel) {
+        auto const weights = bank.weights(mel);
+        REQUIRE(bank.start(mel) + weights.extent(0) <= num_bins);
+        for (auto i{0zu}; i < weights.extent(0); ++i) {
+            REQUIRE(weights[i] > Float(0));
+            dense(mel, bank.start(mel) + i) = weights[i];
+        }
+    }
+
+    // Without normalization the overlapping triangles sum to one between the first and last center
+    if (not normalize and num_mels > 1) {
+        auto edges = std::vector<Float>(num_mels + 2zu);
+        neo::mel_frequencies(stdex::mdspan{edges.data(), stdex::extents{edges.size()}}, Float(20), Float(8000));
+
+        auto const bin_width = sample_rate / static_cast<Float>((num_bins - 1zu) * 2zu);
+        for (auto bin{0zu}; bin < num_bins; ++bin) {
+            auto const hertz = static_cast<Float>(bin) * bin_width;
+            if (hertz < edges[1] or hertz > edges[num_mels]) {
+                continue;
+            }
+
+            auto sum = Float(0);
+            for (auto mel{0zu}; mel < num_mels; ++mel) {
+                sum += dense(mel, bin);
+            }
+            REQUIRE_THAT(sum, Catch::Matchers::WithinAbs(1.0, 0.0001));
+        }
+    }
+
+    // The sparse application matches the dense matrix product
+    auto const num_frames = 3zu;
+    auto const noise      = neo::generate_noise_signal<Float>(num_frames * num_bins, Catch::getSeed());
+    auto const spectra    = stdex::mdspan{noise.data(), stdex::extents{num_frames, num_bins}};
+    auto mels             = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_frames, num_mels};
+    bank(spectra, mels.to_mdspan());
+
+    for (auto frame{0zu}; frame < num_frames; ++frame) {
+        for (auto mel{0zu}; mel < num_mels; ++mel) {
+            auto expected = Float(0);
+            for (auto bin{0zu}; bin < num_bins; ++bin) {
+                expected += dense(mel, bin) * spectra(frame, bin);
+            }
+            REQUIRE_THAT(mels(frame, mel), Catch::Matchers::WithinAbs(expected, 0.0001));
+        }
+    }
+}
@@ -19,6 +19,7 @@
 #include <catch2/generators/catch_generators.hpp>
 
 #include <array>
+#include <cmath>
 #include <random>
 
 namespace {
@@ -61,17 +62,58 @@ auto test_rfft()
     REQUIRE(neo::allclose(stdex::mdspan{original.data(), stdex::extents{original.size()}}, real));
 }
 
+template<typename Plan>
+auto test_rfft_norm()
+{
+    using Float   = typename Plan::real_type;
+    using Complex = typename Plan::complex_type;
+
+    auto const order = GENERATE(as<size_t>{}, 2, 3, 4, 5, 6, 7, 8, 9, 10);
+    auto const norm  = GENERATE(neo::fft::norm::backward, neo::fft::norm::forward, neo::fft::norm::ortho);
+
+    auto rfft = Plan{neo::fft::from_order, order, norm};
+    REQUIRE(rfft.norm() == norm);
+
+    auto unscaled = Plan{neo::fft::from_order, order};
+    REQUIRE(unscaled.norm() == neo::fft::norm::none);
+
+    auto signal         = neo::generate_noise_signal<Float>(rfft.size(), Catch::getSeed());
+    auto spectrum       = std::vector<Complex>(rfft.size() / 2zu + 1zu, Float(0));
+    auto expected       = std::vector<Complex>(rfft.size() / 2zu + 1zu, Float(0));
+    auto const original = signal;
+
+    auto const real    = signal.to_mdspan();
+    auto const complex = stdex::mdspan{spectrum.data(), stdex::extents{spectrum.size()}};
+    auto const ref     = stdex::mdspan{expected.data(), stdex::extents{expected.size()}};
+
+    unscaled(real, ref);
+    if (norm == neo::fft::norm::forward) {
+        neo::scale(Float(1) / static_cast<Float>(rfft.size()), ref);
+    } else if (norm == neo::fft::norm::ortho) {
+        neo::scale(Float(1) / std::sqrt(static_cast<Float>(rfft.size())), ref);
+    }
+
+    rfft(real, complex);
+    REQUIRE(neo::allclose(ref, complex));
+
+    // round-trip without an extra scaling pass
+    rfft(complex, real);
+    REQUIRE(neo::allclose(stdex::mdspan{original.data(), stdex::extents{original.size()}}, real));
+}
+
 }  // namespace
 
 TEMPLATE_PRODUCT_TEST_CASE("neo/fft: fallback_rfft_plan", "", (std_complex, neo_complex), (float, double))
 {
     test_rfft<typename TestType::plan_type>();
+    test_rfft_norm<typename TestType::plan_type>();
 }
 
 #if defined(NEO_HAS_INTEL_IPP)
 TEMPLATE_TEST_CASE("neo/fft: intel_ipp_rfft_plan", "", float, double)
 {
     test_rfft<neo::fft::intel_ipp_rfft_plan<TestType>>();
+    test_rfft_norm<neo::fft::intel_ipp_rfft_plan<TestType>>();
 }
 #endif
 
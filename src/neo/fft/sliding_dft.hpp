@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/complex/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/math/sincos.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <numbers>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace neo::fft {
+
+namespace detail {
+
+/// Accumulates the demodulated samples and advances the phasors of all bins
+template<std::floating_point Float>
+auto sliding_dft_update(
+    Float sample,
+    Float delta,
+    std::size_t num_bins,
+    Float const* NEO_RESTRICT step_re,
+    Float const* NEO_RESTRICT step_im,
+    Float* NEO_RESTRICT phasor_re,
+    Float* NEO_RESTRICT phasor_im,
+    Float* NEO_RESTRICT sum_re,
+    Float* NEO_RESTRICT sum_im,
+    Float* NEO_RESTRICT next_re,
+    Float* NEO_RESTRICT next_im
+) noexcept -> void
+{
+    // For integer bins the samples n and n - N share the phasor
+    for (auto k{0zu}; k < num_bins; ++k) {
+        sum_re[k] += delta * phasor_re[k];
+        sum_im[k] += delta * phasor_im[k];
+        next_re[k] += sample * phasor_re[k];
+        next_im[k] += sample * phasor_im[k];
+
+        auto const re = phasor_re[k] * step_re[k] - phasor_im[k] * step_im[k];
+        auto const im = phasor_re[k] * step_im[k] + phasor_im[k] * step_re[k];
+        phasor_re[k]  = re;
+        phasor_im[k]  = im;
+    }
+}
+
+}  // namespace detail
+
+/// A few bins of the DFT of the last size() samples, updated with every sample (modulated sliding DFT).
+///
+/// The difference of the incoming and the outgoing sample is demodulated by each bin and
+/// accumulated, which is O(num_bins()) per sample. Unlike the recursive SDFT there is no pole
+/// on the unit circle: the demodulating phasors restart every size() samples and the sums are
+/// replaced by a freshly accumulated copy, so rounding errors stay bounded on endless streams.
+/// Updating 32 bins with every sample costs about as much as a rfft_plan of size() every
+/// size() / 4 samples (extra/benchmark/src/goertzel.cpp), so it beats a STFT with a smaller
+/// hop and doesn't add a frame of latency.
+///
+/// \ingroup neo-fft
+template<std::floating_point Float, complex Complex = std::complex<Float>>
+struct sliding_dft
+{
+    using real_type    = Float;
+    using complex_type = Complex;
+    using size_type    = std::size_t;
+
+    /// Throws std::invalid_argument if a bin is not less than size
+    template<in_vector InVec>
+        requires std::integral<value_type_t<InVec>>
+    sliding_dft(size_type size, InVec bins);
+
+    [[nodiscard]] auto size() const noexcept -> size_type { return _history.size(); }
+
+    [[nodiscard]] auto num_bins() const noexcept -> size_type { return _bins.size(); }
+
+    [[nodiscard]] auto bin(size_type index) const noexcept -> size_type { return _bins[index]; }
+
+    /// Clears the history, as if size() zeros were pushed
+    auto reset() noexcept -> void;
+
+    /// Pushes the samples
+    template<in_vector InVec>
+        requires std::convertible_to<value_type_t<InVec>, Float>
+    auto operator()(InVec x) noexcept -> void
+    {
+        for (auto n{0zu}; n < x.extent(0); ++n) {
+            push(static_cast<Float>(x[n]));
+        }
+    }
+
+    /// Pushes the samples and writes the bins after every sample, x.extent(0) x num_bins()
+    template<in_vector InVec, out_matrix OutMat>
+        requires(std::convertible_to<value_type_t<InVec>, Float> and std::same_as<value_type_t<OutMat>, Complex>)
+    auto operator()(InVec x, OutMat out) noexcept -> void
+    {
+        assert(x.extent(0) == out.extent(0));
+        for (auto n{0zu}; n < x.extent(0); ++n) {
+            push(static_cast<Float>(x[n]));
+            spectrum(stdex::submdspan(out, n, stdex::full_extent));
+        }
+    }
+
+    /// X[k] = sum x[n] * exp(-2i * pi * k * n / N) over the last size() samples
+    template<out_vector OutVec>
+        requires std::same_as<value_type_t<OutVec>, Complex>
+    auto spectrum(OutVec out) const noexcept -> void;
+
+private:
+    auto push(Float sample) noexcept -> void;
+
+    size_type _position{0};
+    std::vector<Float> _history;
+    std::vector<size_type> _bins;
+
+    // exp(-2i * pi * k / N) and exp(-2i * pi * k * position / N)
+    std::vector<Float> _step_re;
+    std::vector<Float> _step_im;
+    std::vector<Float> _phasor_re;
+    std::vector<Float> _phasor_im;
+
+    // Demodulated sum over the window and over the samples since the phasors restarted
+    std::vector<Float> _sum_re;
+    std::vector<Float> _sum_im;
+    std::vector<Float> _next_re;
+    std::vector<Float> _next_im;
+};
+
+template<std::floating_point Float, complex Complex>
+template<in_vector InVec>
+    requires std::integral<value_type_t<InVec>>
+sliding_dft<Float, Complex>::sliding_dft(size_type size, InVec bins)
+    : _history(size)
+    , _bins(bins.extent(0))
+    , _step_re(bins.extent(0))
+    , _step_im(bins.extent(0))
+    , _phasor_re(bins.extent(0))
+    , _phasor_im(bins.extent(0))
+    , _sum_re(bins.extent(0))
+    , _sum_im(bins.extent(0))
+    , _next_re(bins.extent(0))
+    , _next_im(bins.extent(0))
+{
+    for (auto k{0zu}; k < num_bins(); ++k) {
+        if (std::cmp_less(bins[k], 0) or std::cmp_greater_equal(bins[k], size)) {
+            throw std::invalid_argument{"sliding_dft: bin must be less than size"};
+        }
+
+        _bins[k]          = static_cast<size_type>(bins[k]);
+        auto const angle  = -std::numbers::pi * 2.0 * static_cast<double>(_bins[k]) / static_cast<double>(size);
+        auto const [s, c] = fast_sincos(angle);
+        _step_re[k]       = static_cast<Float>(c);
+        _step_im[k]       = static_cast<Float>(s);
+    }
+
+    reset();
+}
+
+template<std::floating_point Float, complex Complex>
+auto sliding_dft<Float, Complex>::reset() noexcept -> void
+{
+    std::fill(_history.begin(), _history.end(), Float(0));
+    std::fill(_phasor_re.begin(), _phasor_re.end(), Float(1));
+    std::fill(_phasor_im.begin(), _phasor_im.end(), Float(0));
+    std::fill(_sum_re.begin(), _sum_re.end(), Float(0));
+    std::fill(_sum_im.begin(), _sum_im.end(), Float(0));
+    std::fill(_next_re.begin(), _next_re.end(), Float(0));
+    std::fill(_next_im.begin(), _next_im.end(), Float(0));
+    _position = 0;
+}
+
+template<std::floating_point Float, complex Complex>
+auto sliding_dft<Float, Complex>::push(Float sample) noexcept -> void
+{
+    auto const delta    = sample - _history[_position];
+    _history[_position] = sample;
+
+    detail::sliding_dft_update(
+        sample,
+        delta,
+        _bins.size(),
+        _step_re.data(),
+        _step_im.data(),
+        _phasor_re.data(),
+        _phasor_im.data(),
+        _sum_re.data(),
+        _sum_im.data(),
+        _next_re.data(),
+        _next_im.data()
+    );
+
+    // After N samples the phasors are back at 1 & the new sum covers exactly the window
+    if (++_position == size()) {
+        _position = 0;
+        std::fill(_phasor_re.begin(), _phasor_re.end(), Float(1));
+        std::fill(_phasor_im.begin(), _phasor_im.end(), Float(0));
+        std::swap(_sum_re, _next_re);
+        std::swap(_sum_im, _next_im);
+        std::fill(_next_re.begin(), _next_re.end(), Float(0));
+        std::fill(_next_im.begin(), _next_im.end(), Float(0));
+    }
+}
+
+template<std::floating_point Float, complex Complex>
+template<out_vector OutVec>
+    requires std::same_as<value_type_t<OutVec>, Complex>
+auto sliding_dft<Float, Complex>::spectrum(OutVec out) const noexcept -> void
+{
+    assert(std::cmp_equal(out.extent(0), num_bins()));
+
+    // Rotates the sum to the start of the window, the phasor already belongs to the next sample
+    for (auto k{0zu}; k < num_bins(); ++k) {
+        auto const re = _sum_re[k] * _phasor_re[k] + _sum_im[k] * _phasor_im[k];
+        auto const im = _sum_im[k] * _phasor_re[k] - _sum_re[k] * _phasor_im[k];
+        out[k]        = Complex{re, im};
+    }
+}
+
+}  // namespace neo::fft
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: MIT
+
+#include "sliding_dft.hpp"
+
+#include <neo/complex/scalar_complex.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <complex>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/// DFT bin of the size samples up to and including x[last], zero before the start
+template<typename Float>
+auto window_bin(std::vector<Float> const& x, std::size_t last, std::size_t size, std::size_t bin)
+    -> std::complex<double>
+{
+    auto sum = std::complex<double>{};
+    for (auto n{0zu}; n < size; ++n) {
+        auto const index = static_cast<std::ptrdiff_t>(last + 1zu + n) - static_cast<std::ptrdiff_t>(size);
+        if (index < 0) {
+            continue;
+        }
+        auto const angle = -std::numbers::pi * 2.0 * double(bin) * double(n) / double(size);
+        sum += static_cast<double>(x[static_cast<std::size_t>(index)]) * std::polar(1.0, angle);
+    }
+    return sum;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/fft: sliding_dft", "", std::complex<float>, std::complex<double>, neo::complex128)
+{
+    using Complex = TestType;
+    using Float   = typename Complex::value_type;
+
+    auto const size = GENERATE(as<std::size_t>{}, 16, 100, 256);
+    CAPTURE(size);
+
+    auto const bins = std::vector<std::size_t>{0, 1, 5, size / 2, size - 1};
+    auto sdft       = neo::fft::sliding_dft<Float, Complex>{size, stdex::mdspan{bins.data(), stdex::extents{5zu}}};
+    REQUIRE(sdft.size() == size);
+    REQUIRE(sdft.num_bins() == bins.size());
+    REQUIRE(sdft.bin(2) == 5);
+
+    auto const num_samples = size * 3zu + 37zu;
+    auto const noise       = neo::generate_noise_signal<Float>(num_samples, Catch::getSeed());
+    auto signal            = std::vector<Float>(num_samples);
+    for (auto i{0zu}; i < signal.size(); ++i) {
+        signal[i] = noise(i);
+    }
+
+    auto const tolerance = std::same_as<Float, float> ? 1e-4 : 1e-10;
+    auto out             = stdex::mdarray<Complex, stdex::dextents<std::size_t, 2>>{num_samples, bins.size()};
+    sdft(stdex::mdspan{signal.data(), stdex::extents{num_samples}}, out.to_mdspan());
+
+    for (auto n{0zu}; n < num_samples; n += 7zu) {
+        for (auto k{0zu}; k < bins.size(); ++k) {
+            auto const expected = window_bin(signal, n, size, bins[k]);
+            REQUIRE_THAT(out(n, k).real(), Catch::Matchers::WithinAbs(expected.real(), tolerance * double(size)));
+            REQUIRE_THAT(out(n, k).imag(), Catch::Matchers::WithinAbs(expected.imag(), tolerance * double(size)));
+        }
+    }
+
+    // Streaming in chunks gives the same spectrum
+    auto chunked = neo::fft::sliding_dft<Float, Complex>{size, stdex::mdspan{bins.data(), stdex::extents{5zu}}};
+    for (auto first{0zu}; first < num_samples; first += 33zu) {
+        auto const count = std::min(33zu, num_samples - first);
+        chunked(stdex::mdspan{signal.data() + first, stdex::extents{count}});
+    }
+    auto spectrum = std::vector<Complex>(bins.size());
+    chunked.spectrum(stdex::mdspan{spectrum.data(), stdex::extents{bins.size()}});
+    for (auto k{0zu}; k < bins.size(); ++k) {
+        REQUIRE(spectrum[k].real() == out(num_samples - 1zu, k).real());
+        REQUIRE(spectrum[k].imag() == out(num_samples - 1zu, k).imag());
+    }
+
+    chunked.reset();
+    chunked.spectrum(stdex::mdspan{spectrum.data(), stdex::extents{bins.size()}});
+    for (auto k{0zu}; k < bins.size(); ++k) {
+        REQUIRE(spectrum[k].real() == Float(0));
+        REQUIRE(spectrum[k].imag() == Float(0));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/fft: sliding_dft(long)", "", float, double)
+{
+    using Float = TestType;
+
+    // A unit sine in bin 3 stays at N / 2 after many periods of the window
+    auto const size = 64zu;
+    auto const bins = std::vector<int>{3, 4};
+    auto sdft       = neo::fft::sliding_dft<Float>{size, stdex::mdspan{bins.data(), stdex::extents{2zu}}};
+
+    auto block = std::vector<Float>(size);
+    for (auto n{0zu}; n < size; ++n) {
+        block[n] = static_cast<Float>(std::sin(std::numbers::pi * 2.0 * 3.0 * double(n) / double(size)));
+    }
+    for (auto i{0}; i < 20'000; ++i) {
+        sdft(stdex::mdspan{block.data(), stdex::extents{size}});
+    }
+
+    auto spectrum = std::vector<std::complex<Float>>(2);
+    sdft.spectrum(stdex::mdspan{spectrum.data(), stdex::extents{2zu}});
+    REQUIRE_THAT(std::abs(spectrum[0]), Catch::Matchers::WithinAbs(32.0, 1e-3));
+    REQUIRE_THAT(std::abs(spectrum[1]), Catch::Matchers::WithinAbs(0.0, 1e-3));
+
+    auto const invalid = std::vector<int>{64};
+    REQUIRE_THROWS_AS(
+        (neo::fft::sliding_dft<Float>{size, stdex::mdspan{invalid.data(), stdex::extents{1zu}}}),
+        std::invalid_argument
+    );
+}
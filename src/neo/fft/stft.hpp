@@ -2,18 +2,22 @@
 
 #pragma once
 
-#include <neo/algorithm/copy.hpp>
 #include <neo/algorithm/fill.hpp>
-#include <neo/algorithm/multiply.hpp>
 #include <neo/algorithm/scale.hpp>
 #include <neo/complex/complex.hpp>
 #include <neo/container/mdspan.hpp>
+#include <neo/fft/fft.hpp>
 #include <neo/fft/rfft.hpp>
 #include <neo/math/idiv.hpp>
 #include <neo/math/windowing.hpp>
+#include <neo/parallel/thread_pool.hpp>
 
+#include <algorithm>
+#include <cassert>
 #include <functional>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace neo::fft {
 
@@ -25,6 +29,66 @@ num_sftf_frames(std::size_t signal_size, std::size_t frame_size, std::size_t ove
     return idiv(signal_size - frame_size + overlap_size, frame_size - overlap_size) + 1;
 }
 
+/// Two windowed frames of row ch of x, starting at first & first + hop, in the real & imaginary part of one
+/// complex transform. The spectra are split into even & odd afterwards, which halves the number of transforms.
+/// even_count >= odd_count are the number of samples of both frames, the rest of buffer is zero padding.
+template<typename Float>
+auto stft_frame_pair(
+    auto& plan,
+    in_matrix auto x,
+    std::size_t ch,
+    std::size_t first,
+    std::size_t hop,
+    std::size_t even_count,
+    std::size_t odd_count,
+    in_vector auto window,
+    out_vector auto buffer,
+    out_vector auto even,
+    out_vector auto odd
+) -> void
+{
+    using Complex = value_type_t<decltype(buffer)>;
+
+    // The window only covers the frame, only the zero padding behind it needs clearing
+    if (odd_count != buffer.extent(0)) {
+        fill(stdex::submdspan(buffer, std::tuple{odd_count, buffer.extent(0)}), Complex{});
+    }
+    for (auto i{0zu}; i < odd_count; ++i) {
+        auto const e = static_cast<Float>(x(ch, first + i)) * window[i];
+        auto const o = static_cast<Float>(x(ch, first + hop + i)) * window[i];
+        buffer[i]    = Complex{e, o};
+    }
+    for (auto i{odd_count}; i < even_count; ++i) {
+        buffer[i] = Complex{static_cast<Float>(x(ch, first + i)) * window[i], Float(0)};
+    }
+
+    fft(plan, buffer);
+    rfft_deinterleave(buffer, even, odd);
+}
+
+/// A single windowed frame of row ch of x with count samples, zero padded to the size of the plan
+template<typename Float>
+auto stft_frame(
+    auto& plan,
+    in_matrix auto x,
+    std::size_t ch,
+    std::size_t first,
+    std::size_t count,
+    in_vector auto window,
+    out_vector auto input,
+    out_vector auto out
+) -> void
+{
+    for (auto i{0zu}; i < count; ++i) {
+        input[i] = static_cast<Float>(x(ch, first + i)) * window[i];
+    }
+    if (count != input.extent(0)) {
+        fill(stdex::submdspan(input, std::tuple{count, input.extent(0)}), Float(0));
+    }
+
+    rfft(plan, input, out);
+}
+
 }  // namespace detail
 
 /// \ingroup neo-fft
@@ -54,59 +118,153 @@ struct stft_plan
         fill_window(_window.to_mdspan(), _options.window);
     }
 
+    [[nodiscard]] auto num_bins() const noexcept -> std::size_t { return _workspace.rfft.size() / 2zu + 1zu; }
+
+    [[nodiscard]] auto num_frames(std::size_t signal_size) const noexcept -> std::size_t
+    {
+        return detail::num_sftf_frames(signal_size, _options.frame_size, _options.overlap_size);
+    }
+
     template<in_matrix InMat>
         requires std::convertible_to<value_type_t<InMat>, Float>
     [[nodiscard]] auto operator()(InMat x)
     {
-        auto const frame_len = _options.frame_size;
-        auto const overlap   = _options.overlap_size;
+        auto result = allocate_result(x);
+        (*this)(x, result.to_mdspan());
+        return result;
+    }
 
-        auto const num_channels = static_cast<std::size_t>(x.extent(0));
-        auto const signal_len   = static_cast<std::size_t>(x.extent(1));
+    /// Writes into a channels x num_frames() x num_bins() output without allocating
+    template<in_matrix InMat, typename OutTensor>
+        requires(std::convertible_to<value_type_t<InMat>, Float> and is_mdspan<OutTensor> and OutTensor::rank() == 3)
+    auto operator()(InMat x, OutTensor out) -> void
+    {
+        assert(out.extent(0) == x.extent(0));
+        assert(out.extent(1) == num_frames(x.extent(1)));
+        assert(out.extent(2) == num_bins());
 
-        auto const num_bins   = _rfft.size() / 2zu + 1zu;
-        auto const num_frames = detail::num_sftf_frames(signal_len, frame_len, overlap);
+        for (auto ch_idx = std::size_t(0); ch_idx < x.extent(0); ++ch_idx) {
+            transform_frames(x, ch_idx, 0, out.extent(1), out, _workspace);
+        }
+    }
 
-        auto const in  = _input.to_mdspan();
-        auto const out = _output.to_mdspan();
+    /// Ranges of frames_per_task frames of all channels are transformed in parallel,
+    /// each thread of the pool uses its own buffers. The result is identical to the serial one.
+    template<in_matrix InMat>
+        requires std::convertible_to<value_type_t<InMat>, Float>
+    [[nodiscard]] auto operator()(InMat x, thread_pool& pool)
+    {
+        auto result = allocate_result(x);
+        (*this)(x, result.to_mdspan(), pool);
+        return result;
+    }
+
+    /// \copydoc operator()(InMat, thread_pool&)
+    template<in_matrix InMat, typename OutTensor>
+        requires(std::convertible_to<value_type_t<InMat>, Float> and is_mdspan<OutTensor> and OutTensor::rank() == 3)
+    auto operator()(InMat x, OutTensor out, thread_pool& pool) -> void
+    {
+        assert(out.extent(0) == x.extent(0));
+        assert(out.extent(1) == num_frames(x.extent(1)));
+        assert(out.extent(2) == num_bins());
 
-        auto result = stdex::mdarray<Complex, stdex::dextents<std::size_t, 3>>{
-            num_channels,
-            num_frames,
-            num_bins,
+        while (_workspaces.size() < pool.concurrency()) {
+            _workspaces.emplace_back(next_order(_options.transform_size));
+        }
+
+        auto const num_frames = static_cast<std::size_t>(out.extent(1));
+        auto const num_tasks  = idiv(num_frames + frames_per_task - 1zu, frames_per_task);
+        auto const task = [this, x, out, num_frames, num_tasks](std::size_t worker, std::size_t index) {
+            auto const first = (index % num_tasks) * frames_per_task;
+            auto const last  = std::min(first + frames_per_task, num_frames);
+            transform_frames(x, index / num_tasks, first, last, out, _workspaces[worker]);
         };
+        pool.parallel_for(x.extent(0) * num_tasks, task);
+    }
 
-        for (auto ch_idx = std::size_t(0); ch_idx < num_channels; ++ch_idx) {
-            for (auto frame_idx = std::size_t(0); frame_idx < num_frames; ++frame_idx) {
-                auto const sample_idx  = frame_idx * frame_len - frame_idx * overlap;
-                auto const num_samples = std::min(signal_len - sample_idx, frame_len);
+private:
+    // Even, so that the frames of a task pair up the same way as in a serial run
+    static constexpr auto frames_per_task = 32zu;
 
-                auto const in_block  = stdex::submdspan(x, ch_idx, std::tuple{sample_idx, sample_idx + num_samples});
-                auto const in_window = stdex::submdspan(in, std::tuple{0, num_samples});
-                fill(in, Float(0));
-                fill(out, Float(0));
-                copy(in_block, in_window);
+    struct workspace
+    {
+        explicit workspace(std::size_t order)
+            : rfft{from_order, order}
+            , fft{from_order, order}
+            , input{rfft.size()}
+            , buffer{rfft.size()}
+        {}
 
-                multiply(in, _window.to_mdspan(), in);
-                _rfft(in, out);
+        rfft_plan<Float, Complex> rfft;
+        fft_plan<Complex> fft;
+        stdex::mdarray<Float, stdex::dextents<std::size_t, 1>> input;
+        stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>> buffer;
+    };
 
-                auto coeffs       = stdex::submdspan(out, std::tuple{0, num_bins});
-                auto result_frame = stdex::submdspan(result.to_mdspan(), ch_idx, frame_idx, std::tuple{0, num_bins});
-                copy(coeffs, result_frame);
-            }
+    [[nodiscard]] auto allocate_result(in_matrix auto x) const
+    {
+        auto const channels = static_cast<std::size_t>(x.extent(0));
+        auto const frames   = num_frames(x.extent(1));
+        return stdex::mdarray<Complex, stdex::dextents<std::size_t, 3>>{channels, frames, num_bins()};
+    }
+
+    [[nodiscard]] auto frame_length(std::size_t frame_idx, std::size_t signal_len) const noexcept -> std::size_t
+    {
+        auto const sample_idx = frame_idx * (_options.frame_size - _options.overlap_size);
+        return std::min(signal_len - sample_idx, _options.frame_size);
+    }
+
+    /// Transforms frames [first, last) of one channel. Pairs of frames are packed into the real and imaginary
+    /// part of a single complex transform and split afterwards, which halves the number of transforms.
+    auto transform_frames(
+        in_matrix auto x,
+        std::size_t ch_idx,
+        std::size_t first,
+        std::size_t last,
+        auto result,
+        workspace& ws
+    ) const -> void
+    {
+        auto const hop        = _options.frame_size - _options.overlap_size;
+        auto const signal_len = static_cast<std::size_t>(x.extent(1));
+        auto const window     = _window.to_mdspan();
+
+        auto frame_idx = first;
+        for (; frame_idx + 1zu < last; frame_idx += 2zu) {
+            detail::stft_frame_pair<Float>(
+                ws.fft,
+                x,
+                ch_idx,
+                frame_idx * hop,
+                hop,
+                frame_length(frame_idx, signal_len),
+                frame_length(frame_idx + 1zu, signal_len),
+                window,
+                ws.buffer.to_mdspan(),
+                stdex::submdspan(result, ch_idx, frame_idx, stdex::full_extent),
+                stdex::submdspan(result, ch_idx, frame_idx + 1zu, stdex::full_extent)
+            );
         }
 
-        return result;
+        if (frame_idx < last) {
+            detail::stft_frame<Float>(
+                ws.rfft,
+                x,
+                ch_idx,
+                frame_idx * hop,
+                frame_length(frame_idx, signal_len),
+                window,
+                ws.input.to_mdspan(),
+                stdex::submdspan(result, ch_idx, frame_idx, stdex::full_extent)
+            );
+        }
     }
 
-private:
     stft_options<Float> _options;
+    workspace _workspace{next_order(_options.transform_size)};
 
-    rfft_plan<Float> _rfft{from_order, next_order(_options.transform_size)};
-    stdex::mdarray<Float, stdex::dextents<std::size_t, 1>> _input{_rfft.size()};
-    stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>> _output{_rfft.size()};
-
-    stdex::mdarray<Float, stdex::dextents<std::size_t, 1>> _window{_rfft.size()};
+    stdex::mdarray<Float, stdex::dextents<std::size_t, 1>> _window{_options.frame_size};
+    std::vector<workspace> _workspaces;
 };
 
 /// \ingroup neo-fft
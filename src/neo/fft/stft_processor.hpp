@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/algorithm/copy.hpp>
+#include <neo/algorithm/fill.hpp>
+#include <neo/complex/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fft/rfft.hpp>
+#include <neo/fft/stft.hpp>
+#include <neo/math/windowing.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace neo::fft {
+
+/// Streaming STFT -> ISTFT with weighted overlap-add (WOLA) resynthesis.
+///
+/// Accepts chunks of any size. Every hop_size() samples a frame is windowed, transformed
+/// and handed to the callback as a channels x bins spectrum, which may be modified in place.
+/// The inverse transform is windowed with the dual of the analysis window, so unmodified
+/// spectra reconstruct the input exactly, delayed by latency() samples. All buffers are
+/// allocated in the constructor.
+///
+/// \ingroup neo-fft
+template<std::floating_point Float, complex Complex = std::complex<Float>>
+struct stft_processor
+{
+    using real_type    = Float;
+    using complex_type = Complex;
+    using size_type    = std::size_t;
+
+    /// Throws std::invalid_argument if the window can't be inverted with the given overlap
+    stft_processor(size_type num_channels, stft_options<Float> const& options);
+
+    [[nodiscard]] auto num_channels() const noexcept -> size_type { return _input.extent(0); }
+
+    [[nodiscard]] auto frame_size() const noexcept -> size_type { return _input.extent(1); }
+
+    [[nodiscard]] auto hop_size() const noexcept -> size_type { return _hop_size; }
+
+    [[nodiscard]] auto transform_size() const noexcept -> size_type { return _rfft.size(); }
+
+    [[nodiscard]] auto num_bins() const noexcept -> size_type { return _spectrum.extent(1); }
+
+    [[nodiscard]] auto latency() const noexcept -> size_type { return frame_size(); }
+
+    [[nodiscard]] auto analysis_window() const noexcept { return _analysis.to_mdspan(); }
+
+    [[nodiscard]] auto synthesis_window() const noexcept { return _synthesis.to_mdspan(); }
+
+    auto reset() -> void;
+
+    /// Calls process(spectrum) with a channels x bins inout_matrix for every completed frame
+    template<inout_matrix InOutMat, typename Processor>
+        requires std::invocable<Processor&, stdex::mdspan<Complex, stdex::dextents<size_type, 2>>>
+    auto operator()(InOutMat io, Processor&& process) -> void;
+
+private:
+    auto process_frame(auto& process) -> void;
+
+    size_type _hop_size;
+    size_type _position{0};
+
+    rfft_plan<Float, Complex> _rfft;
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _analysis;
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _synthesis;
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _buffer;
+
+    stdex::mdarray<Float, stdex::dextents<size_type, 2>> _input;
+    stdex::mdarray<Float, stdex::dextents<size_type, 2>> _output;
+    stdex::mdarray<Complex, stdex::dextents<size_type, 2>> _spectrum;
+};
+
+template<std::floating_point Float, complex Complex>
+stft_processor<Float, Complex>::stft_processor(size_type num_channels, stft_options<Float> const& options)
+    : _hop_size{options.frame_size - options.overlap_size}
+    , _rfft{from_order, next_order(std::max(options.transform_size, options.frame_size)), norm::backward}
+    , _analysis{options.frame_size}
+    , _synthesis{options.frame_size}
+    , _buffer{_rfft.size()}
+    , _input{num_channels, options.frame_size}
+    , _output{num_channels, options.frame_size}
+    , _spectrum{num_channels, _rfft.size() / 2zu + 1zu}
+{
+    if (options.frame_size == 0 or options.overlap_size >= options.frame_size) {
+        throw std::invalid_argument{"stft_processor: overlap_size must be less than frame_size"};
+    }
+
+    fill_window(_analysis.to_mdspan(), options.window);
+
+    // Dual window: w[n] / sum_k w[n + k * hop]^2, so that analysis * synthesis is COLA
+    for (auto n{0zu}; n < frame_size(); ++n) {
+        auto sum = Float(0);
+        for (auto i{n % _hop_size}; i < frame_size(); i += _hop_size) {
+            sum += _analysis(i) * _analysis(i);
+        }
+        if (sum <= std::numeric_limits<Float>::epsilon()) {
+            throw std::invalid_argument{"stft_processor: window does not satisfy the overlap-add condition"};
+        }
+        _synthesis(n) = _analysis(n) / sum;
+    }
+
+    reset();
+}
+
+template<std::floating_point Float, complex Complex>
+auto stft_processor<Float, Complex>::reset() -> void
+{
+    fill(_input.to_mdspan(), Float(0));
+    fill(_output.to_mdspan(), Float(0));
+    _position = 0;
+}
+
+template<std::floating_point Float, complex Complex>
+template<inout_matrix InOutMat, typename Processor>
+    requires std::invocable<Processor&, stdex::mdspan<Complex, stdex::dextents<std::size_t, 2>>>
+auto stft_processor<Float, Complex>::operator()(InOutMat io, Processor&& process) -> void
+{
+    assert(io.extent(0) == num_channels());
+
+    auto const input  = _input.to_mdspan();
+    auto const output = _output.to_mdspan();
+    auto const tail   = frame_size() - _hop_size;
+
+    for (auto offset{0zu}; offset < io.extent(1);) {
+        auto const count = std::min(_hop_size - _position, io.extent(1) - offset);
+        for (auto ch{0zu}; ch < num_channels(); ++ch) {
+            for (auto i{0zu}; i < count; ++i) {
+                input(ch, tail + _position + i) = static_cast<Float>(io(ch, offset + i));
+                io(ch, offset + i)              = output(ch, _position + i);
+            }
+        }
+
+        offset += count;
+        _position += count;
+
+        if (_position == _hop_size) {
+            process_frame(process);
+            _position = 0;
+        }
+    }
+}
+
+template<std::floating_point Float, complex Complex>
+auto stft_processor<Float, Complex>::process_frame(auto& process) -> void
+{
+    auto const input    = _input.to_mdspan();
+    auto const output   = _output.to_mdspan();
+    auto const spectrum = _spectrum.to_mdspan();
+    auto const buffer   = _buffer.to_mdspan();
+    auto const frame    = frame_size();
+    auto const tail     = frame - _hop_size;
+
+    // Only the first frame_size samples are windowed, the inverse transform of the last frame overwrote the padding
+    if (frame != buffer.extent(0)) {
+        fill(stdex::submdspan(buffer, std::tuple{frame, buffer.extent(0)}), Float(0));
+    }
+
+    for (auto ch{0zu}; ch < num_channels(); ++ch) {
+        for (auto i{0zu}; i < frame; ++i) {
+            buffer[i] = input(ch, i) * _analysis(i);
+        }
+        rfft(_rfft, buffer, stdex::submdspan(spectrum, ch, stdex::full_extent));
+    }
+
+    process(spectrum);
+
+    for (auto ch{0zu}; ch < num_channels(); ++ch) {
+        irfft(_rfft, stdex::submdspan(spectrum, ch, stdex::full_extent), buffer);
+
+        // Drop the hop that has been written out and overlap-add the new frame
+        for (auto i{0zu}; i < tail; ++i) {
+            output(ch, i) = output(ch, i + _hop_size) + buffer[i] * _synthesis(i);
+        }
+        for (auto i{tail}; i < frame; ++i) {
+            output(ch, i) = buffer[i] * _synthesis(i);
+        }
+
+        for (auto i{0zu}; i < tail; ++i) {
+            input(ch, i) = input(ch, i + _hop_size);
+        }
+    }
+}
+
+}  // namespace neo::fft
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: MIT
+
+#include "stft_processor.hpp"
+
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <bit>
+#include <random>
+#include <stdexcept>
+
+TEMPLATE_TEST_CASE("neo/fft: stft_processor", "", float, double)
+{
+    using Float = TestType;
+
+    auto const num_channels = GENERATE(as<std::size_t>{}, 1, 2);
+    auto const frame_size   = GENERATE(as<std::size_t>{}, 64, 100, 256);
+    auto const overlap      = GENERATE(as<std::size_t>{}, 0, 2, 4);
+    CAPTURE(num_channels);
+    CAPTURE(frame_size);
+    CAPTURE(overlap);
+
+    auto options = neo::fft::stft_options<Float>{
+        .frame_size     = frame_size,
+        .transform_size = frame_size * 2zu,
+        .overlap_size   = overlap == 0 ? 0zu : frame_size - frame_size / overlap,
+    };
+
+    // The hann window is zero at both ends, it can't be inverted without overlap
+    if (overlap == 0) {
+        options.window = neo::rectangular_window<Float>{};
+    }
+
+    auto stft = neo::fft::stft_processor<Float>{num_channels, options};
+    REQUIRE(stft.num_channels() == num_channels);
+    REQUIRE(stft.frame_size() == frame_size);
+    REQUIRE(stft.hop_size() == frame_size - options.overlap_size);
+    REQUIRE(stft.transform_size() == std::bit_ceil(frame_size * 2zu));
+    REQUIRE(stft.num_bins() == stft.transform_size() / 2zu + 1zu);
+    REQUIRE(stft.latency() == frame_size);
+
+    auto const product = [&] {
+        auto result = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{frame_size};
+        for (auto i{0zu}; i < frame_size; ++i) {
+            result(i) = stft.analysis_window()(i) * stft.synthesis_window()(i);
+        }
+        return result;
+    }();
+    REQUIRE(neo::is_cola(product.to_mdspan(), stft.hop_size()));
+
+    auto const num_samples = 4000zu;
+    auto const noise       = neo::generate_noise_signal<Float>(num_channels * num_samples, Catch::getSeed());
+    auto const signal      = stdex::mdspan{noise.data(), stdex::extents{num_channels, num_samples}};
+    auto output            = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_channels, num_samples};
+    neo::copy(signal, output.to_mdspan());
+
+    // Unmodified spectra reconstruct the delayed input, callback sizes are random
+    auto num_frames = 0zu;
+    auto rng        = std::mt19937{Catch::getSeed()};
+    auto dist       = std::uniform_int_distribution<std::size_t>{0, 700};
+    for (auto offset{0zu}; offset < num_samples;) {
+        auto const size = std::min(dist(rng), num_samples - offset);
+        auto const io   = stdex::submdspan(output.to_mdspan(), stdex::full_extent, std::tuple{offset, offset + size});
+        stft(io, [&num_frames, &stft](auto spectrum) {
+            REQUIRE(spectrum.extent(0) == stft.num_channels());
+            REQUIRE(spectrum.extent(1) == stft.num_bins());
+            ++num_frames;
+        });
+        offset += size;
+    }
+
+    REQUIRE(num_frames == num_samples / stft.hop_size());
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        for (auto i{0zu}; i < num_samples; ++i) {
+            auto const expected = i < stft.latency() ? Float(0) : signal(ch, i - stft.latency());
+            REQUIRE_THAT(output(ch, i), Catch::Matchers::WithinAbs(expected, 0.0001));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/fft: stft_processor(process)", "", float, double)
+{
+    using Float = TestType;
+
+    auto stft = neo::fft::stft_processor<Float>{1, {.frame_size = 256, .transform_size = 256, .overlap_size = 192}};
+    REQUIRE_THROWS_AS(
+        (neo::fft::stft_processor<Float>{1, {.frame_size = 256, .transform_size = 256, .overlap_size = 256}}),
+        std::invalid_argument
+    );
+
+    auto const noise = neo::generate_noise_signal<Float>(2048zu, Catch::getSeed());
+    auto block       = noise;
+    auto io          = stdex::mdspan{block.data(), stdex::extents{1zu, block.extent(0)}};
+
+    // Removing all bins silences the output
+    stft(io, [](auto spectrum) { neo::fill(spectrum, std::complex<Float>{}); });
+    for (auto i{0zu}; i < block.extent(0); ++i) {
+        REQUIRE(block(i) == Float(0));
+    }
+
+    stft.reset();
+    neo::copy(noise.to_mdspan(), block.to_mdspan());
+    stft(io, [](auto) {});
+    for (auto i{stft.latency()}; i < block.extent(0); ++i) {
+        REQUIRE_THAT(block(i), Catch::Matchers::WithinAbs(noise(i - stft.latency()), 0.0001));
+    }
+}
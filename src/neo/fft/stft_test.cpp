@@ -2,6 +2,10 @@
 
 #include "stft.hpp"
 
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 
@@ -35,3 +39,89 @@ TEMPLATE_TEST_CASE("neo/fft: stft", "", float, double)
     REQUIRE(half_overlap.extent(1) == 16);
     REQUIRE(half_overlap.extent(2) == 129);
 }
+
+TEMPLATE_TEST_CASE("neo/fft: stft(thread_pool)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const num_channels = GENERATE(as<std::size_t>{}, 1, 2, 7);
+    auto const num_samples  = GENERATE(as<std::size_t>{}, 2048, 20000);
+    auto const noise        = neo::generate_noise_signal<Float>(num_channels * num_samples, Catch::getSeed());
+    auto const signal       = stdex::mdspan{noise.data(), stdex::extents{num_channels, num_samples}};
+
+    auto pool     = neo::thread_pool{3};
+    auto plan     = neo::fft::stft_plan<Float>{256};
+    auto serial   = plan(signal);
+    auto parallel = plan(signal, pool);
+
+    REQUIRE(parallel.extents() == serial.extents());
+    for (auto ch{0zu}; ch < serial.extent(0); ++ch) {
+        for (auto frame{0zu}; frame < serial.extent(1); ++frame) {
+            for (auto bin{0zu}; bin < serial.extent(2); ++bin) {
+                REQUIRE(parallel(ch, frame, bin) == serial(ch, frame, bin));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/fft: stft(out)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const frame_size     = GENERATE(as<std::size_t>{}, 128, 256);
+    auto const transform_size = GENERATE(as<std::size_t>{}, 256, 512);
+    CAPTURE(frame_size);
+    CAPTURE(transform_size);
+
+    auto const noise  = neo::generate_noise_signal<Float>(2zu * 1000zu, Catch::getSeed());
+    auto const signal = stdex::mdspan{noise.data(), stdex::extents{2zu, 1000zu}};
+
+    auto plan = neo::fft::stft_plan<Float>{{
+        .frame_size     = frame_size,
+        .transform_size = transform_size,
+        .overlap_size   = frame_size / 2zu,
+    }};
+
+    auto const expected = plan(signal);
+    REQUIRE(expected.extent(1) == plan.num_frames(signal.extent(1)));
+    REQUIRE(expected.extent(2) == plan.num_bins());
+
+    auto actual = stdex::mdarray<std::complex<Float>, stdex::dextents<std::size_t, 3>>{
+        expected.extent(0),
+        expected.extent(1),
+        expected.extent(2),
+    };
+    plan(signal, actual.to_mdspan());
+
+    auto rfft   = neo::fft::rfft_plan<Float>{neo::fft::from_order, neo::fft::next_order(transform_size)};
+    auto input  = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{transform_size};
+    auto output = stdex::mdarray<std::complex<Float>, stdex::dextents<std::size_t, 1>>{transform_size};
+    auto window = neo::hann_window<Float>{};
+
+    for (auto ch{0zu}; ch < expected.extent(0); ++ch) {
+        for (auto frame{0zu}; frame < expected.extent(1); ++frame) {
+            for (auto bin{0zu}; bin < expected.extent(2); ++bin) {
+                REQUIRE(actual(ch, frame, bin) == expected(ch, frame, bin));
+            }
+        }
+    }
+
+    // The window spans frame_size samples, the rest of the transform is zero padding.
+    // Frames are transformed in pairs, the last one might be on its own.
+    for (auto frame : {0zu, 1zu, expected.extent(1) - 1zu}) {
+        auto const start = frame * frame_size / 2zu;
+        auto const size  = std::min(frame_size, signal.extent(1) - start);
+        neo::fill(input.to_mdspan(), Float(0));
+        for (auto i{0zu}; i < size; ++i) {
+            input(i) = signal(1, start + i) * window(i, frame_size);
+        }
+        rfft(input.to_mdspan(), output.to_mdspan());
+
+        for (auto bin{0zu}; bin < expected.extent(2); ++bin) {
+            CAPTURE(frame);
+            CAPTURE(bin);
+            REQUIRE(expected(1, frame, bin).real() == Catch::Approx(output(bin).real()).margin(0.0001));
+            REQUIRE(expected(1, frame, bin).imag() == Catch::Approx(output(bin).imag()).margin(0.0001));
+        }
+    }
+}
@@ -7,8 +7,13 @@
 #include <neo/complex/complex.hpp>
 #include <neo/fft/direction.hpp>
 #include <neo/math/polar.hpp>
+#include <neo/math/sincos.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <concepts>
+#include <cstddef>
 #include <numbers>
 
 namespace neo::fft {
@@ -28,17 +33,49 @@ template<complex Complex>
     return Complex{w.real(), w.imag()};           // convert to custom complex (maybe)
 }
 
+/// lut[i] = twiddle(lut.size() * 2, i, dir), the angles are evaluated in double
 /// \ingroup neo-fft
 template<inout_vector OutVec>
 auto fill_twiddle_lut_radix2(OutVec lut, direction dir) noexcept -> void
 {
     using Complex = typename OutVec::value_type;
+    using Float   = typename Complex::value_type;
 
     auto const lut_size = lut.size();
-    auto const size     = lut_size * 2ULL;
+    auto const sign     = dir == direction::forward ? -1.0 : 1.0;
+    auto const step     = sign * std::numbers::pi / static_cast<double>(lut_size);
 
     for (std::size_t i = 0; i < lut_size; ++i) {
-        lut[i] = twiddle<Complex>(size, i, dir);
+        auto const [s, c] = fast_sincos(step * static_cast<double>(i));
+        lut[i]            = Complex{static_cast<Float>(c), static_cast<Float>(s)};
+    }
+}
+
+/// Chirp lut[n] = exp(-i * pi * (2 * start * n + step * n^2)), e.g. start = 0 & step = +-1 / N for Bluestein.
+/// n^2 is exact in double & the phase is reduced to one turn before the sincos, so the angles stay small.
+/// \ingroup neo-fft
+template<inout_vector OutVec>
+auto fill_chirp(OutVec lut, double start, double step) noexcept -> void
+{
+    using Complex = typename OutVec::value_type;
+    using Float   = typename Complex::value_type;
+
+    static constexpr auto block_size = 64zu;
+
+    auto const size = static_cast<std::size_t>(lut.extent(0));
+    auto angles     = std::array<double, block_size>{};
+    for (auto first{0zu}; first < size; first += block_size) {
+        auto const count = std::min(block_size, size - first);
+        for (auto i{0zu}; i < count; ++i) {
+            // The half turns grow with n^2 and are wrapped to [-1, 1]
+            auto const n     = static_cast<double>(first + i);
+            auto const turns = std::fma(n * n, step, 2.0 * start * n);
+            angles[i]        = -std::numbers::pi * (turns - 2.0 * std::round(turns * 0.5));
+        }
+        for (auto i{0zu}; i < count; ++i) {
+            auto const [s, c] = fast_sincos(angles[i]);
+            lut[first + i]    = Complex{static_cast<Float>(c), static_cast<Float>(s)};
+        }
     }
 }
 
@@ -0,0 +1,13 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+/// \defgroup neo-iir IIR
+/// Recursive filters
+
+#include <neo/iir/a_weighting.hpp>
+#include <neo/iir/biquad.hpp>
+#include <neo/iir/biquad_cascade.hpp>
+#include <neo/iir/lookahead_biquad_cascade.hpp>
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/iir/biquad.hpp>
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <numbers>
+
+namespace neo::iir {
+
+namespace detail {
+
+/// Bilinear transform of (n2 * s^2 + n1 * s + n0) / (d2 * s^2 + d1 * s + d0)
+template<std::floating_point Float>
+[[nodiscard]] auto bilinear(std::array<double, 3> const& num, std::array<double, 3> const& den, double sample_rate)
+    -> biquad_coefficients<Float>
+{
+    auto const k  = 2.0 * sample_rate;
+    auto const kk = k * k;
+    return normalize_biquad<Float>(
+        num[2] * kk + num[1] * k + num[0],
+        2.0 * (num[0] - num[2] * kk),
+        num[2] * kk - num[1] * k + num[0],
+        den[2] * kk + den[1] * k + den[0],
+        2.0 * (den[0] - den[2] * kk),
+        den[2] * kk - den[1] * k + den[0]
+    );
+}
+
+}  // namespace detail
+
+/// A-weighting (IEC 61672) as three biquads, normalized to 0 dB at 1 kHz.
+///
+/// The analog filter is mapped with the bilinear transform. For sample rates of 44.1 kHz
+/// & above the error against a_weighting(frequency) stays below 0.1 dB up to 4 kHz,
+/// towards nyquist the response falls off faster than the analog one.
+///
+/// \ingroup neo-iir
+template<std::floating_point Float>
+[[nodiscard]] auto make_a_weighting(Float sample_rate) -> std::array<biquad_coefficients<Float>, 3>
+{
+    // Prewarping the poles moves the error into the audible range, so they are mapped as is
+    auto const fs = static_cast<double>(sample_rate);
+    auto const w1 = std::numbers::pi * 2.0 * 20.598997;
+    auto const w2 = std::numbers::pi * 2.0 * 107.65265;
+    auto const w3 = std::numbers::pi * 2.0 * 737.86223;
+    auto const w4 = std::numbers::pi * 2.0 * 12194.217;
+
+    auto sections = std::array{
+        detail::bilinear<double>({0.0, 0.0, 1.0}, {w4 * w4, 2.0 * w4, 1.0}, fs),
+        detail::bilinear<double>({0.0, 0.0, 1.0}, {w1 * w1, 2.0 * w1, 1.0}, fs),
+        detail::bilinear<double>({1.0, 0.0, 0.0}, {w2 * w3, w2 + w3, 1.0}, fs),
+    };
+
+    auto gain = 1.0;
+    for (auto const& section : sections) {
+        gain *= std::abs(frequency_response(section, fs, 1000.0));
+    }
+
+    // The gain goes into the last section
+    auto result = std::array<biquad_coefficients<Float>, 3>{};
+    for (auto i{0zu}; i < sections.size(); ++i) {
+        auto const scale = i == sections.size() - 1zu ? 1.0 / gain : 1.0;
+        result[i].b0     = static_cast<Float>(sections[i].b0 * scale);
+        result[i].b1     = static_cast<Float>(sections[i].b1 * scale);
+        result[i].b2     = static_cast<Float>(sections[i].b2 * scale);
+        result[i].a1     = static_cast<Float>(sections[i].a1);
+        result[i].a2     = static_cast<Float>(sections[i].a2);
+    }
+    return result;
+}
+
+}  // namespace neo::iir
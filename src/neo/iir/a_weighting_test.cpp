@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: MIT
+
+#include "a_weighting.hpp"
+
+#include <neo/math/a_weighting.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <cmath>
+#include <complex>
+
+TEMPLATE_TEST_CASE("neo/iir: make_a_weighting", "", float, double)
+{
+    using Float = TestType;
+
+    auto const sample_rate = GENERATE(Float(44'100), Float(48'000), Float(96'000));
+    auto const frequency   = GENERATE(Float(20), Float(100), Float(1'000), Float(2'000), Float(4'000));
+    CAPTURE(sample_rate, frequency);
+
+    auto const sections = neo::iir::make_a_weighting(sample_rate);
+
+    auto response = std::complex<Float>{1};
+    for (auto const& section : sections) {
+        response *= neo::iir::frequency_response(section, sample_rate, frequency);
+    }
+
+    auto const db = Float(20) * std::log10(std::abs(response));
+    REQUIRE(db == Catch::Approx(neo::a_weighting(frequency)).margin(0.1));
+}
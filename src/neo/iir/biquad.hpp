@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <numbers>
+#include <utility>
+
+namespace neo::iir {
+
+/// Second order section normalized to a0 = 1,
+/// H(z) = (b0 + b1 * z^-1 + b2 * z^-2) / (1 + a1 * z^-1 + a2 * z^-2)
+/// \ingroup neo-iir
+template<std::floating_point Float>
+struct biquad_coefficients
+{
+    Float b0{1};
+    Float b1{0};
+    Float b2{0};
+    Float a1{0};
+    Float a2{0};
+
+    [[nodiscard]] auto operator==(biquad_coefficients const& other) const noexcept -> bool = default;
+};
+
+namespace detail {
+
+template<std::floating_point Float>
+[[nodiscard]] auto normalize_biquad(double b0, double b1, double b2, double a0, double a1, double a2) noexcept
+    -> biquad_coefficients<Float>
+{
+    return {
+        .b0 = static_cast<Float>(b0 / a0),
+        .b1 = static_cast<Float>(b1 / a0),
+        .b2 = static_cast<Float>(b2 / a0),
+        .a1 = static_cast<Float>(a1 / a0),
+        .a2 = static_cast<Float>(a2 / a0),
+    };
+}
+
+/// cos(w0) & alpha of the audio EQ cookbook
+[[nodiscard]] inline auto biquad_prototype(double sample_rate, double frequency, double q) noexcept
+    -> std::pair<double, double>
+{
+    auto const w0 = std::numbers::pi * 2.0 * frequency / sample_rate;
+    return {std::cos(w0), std::sin(w0) / (2.0 * q)};
+}
+
+}  // namespace detail
+
+/// \ingroup neo-iir
+template<std::floating_point Float>
+[[nodiscard]] auto make_lowpass(Float sample_rate, Float frequency, Float q) noexcept -> biquad_coefficients<Float>
+{
+    auto const [c, alpha] = detail::biquad_prototype(sample_rate, frequency, q);
+    auto const b0         = (1.0 - c) * 0.5;
+    return detail::normalize_biquad<Float>(b0, 1.0 - c, b0, 1.0 + alpha, -2.0 * c, 1.0 - alpha);
+}
+
+/// \ingroup neo-iir
+template<std::floating_point Float>
+[[nodiscard]] auto make_highpass(Float sample_rate, Float frequency, Float q) noexcept -> biquad_coefficients<Float>
+{
+    auto const [c, alpha] = detail::biquad_prototype(sample_rate, frequency, q);
+    auto const b0         = (1.0 + c) * 0.5;
+    return detail::normalize_biquad<Float>(b0, -(1.0 + c), b0, 1.0 + alpha, -2.0 * c, 1.0 - alpha);
+}
+
+/// Unity gain at the center frequency
+/// \ingroup neo-iir
+template<std::floating_point Float>
+[[nodiscard]] auto make_bandpass(Float sample_rate, Float frequency, Float q) noexcept -> biquad_coefficients<Float>
+{
+    auto const [c, alpha] = detail::biquad_prototype(sample_rate, frequency, q);
+    return detail::normalize_biquad<Float>(alpha, 0.0, -alpha, 1.0 + alpha, -2.0 * c, 1.0 - alpha);
+}
+
+/// \ingroup neo-iir
+template<std::floating_point Float>
+[[nodiscard]] auto make_notch(Float sample_rate, Float frequency, Float q) noexcept -> biquad_coefficients<Float>
+{
+    auto const [c, alpha] = detail::biquad_prototype(sample_rate, frequency, q);
+    return detail::normalize_biquad<Float>(1.0, -2.0 * c, 1.0, 1.0 + alpha, -2.0 * c, 1.0 - alpha);
+}
+
+/// \ingroup neo-iir
+template<std::floating_point Float>
+[[nodiscard]] auto make_peak(Float sample_rate, Float frequency, Float q, Float gain_db) noexcept
+    -> biquad_coefficients<Float>
+{
+    auto const [c, alpha] = detail::biquad_prototype(sample_rate, frequency, q);
+    auto const a          = std::pow(10.0, static_cast<double>(gain_db) / 40.0);
+    return detail::normalize_biquad<Float>(
+        1.0 + alpha * a,
+        -2.0 * c,
+        1.0 - alpha * a,
+        1.0 + alpha / a,
+        -2.0 * c,
+        1.0 - alpha / a
+    );
+}
+
+/// \ingroup neo-iir
+template<std::floating_point Float>
+[[nodiscard]] auto make_low_shelf(Float sample_rate, Float frequency, Float q, Float gain_db) noexcept
+    -> biquad_coefficients<Float>
+{
+    auto const [c, alpha] = detail::biquad_prototype(sample_rate, frequency, q);
+    auto const a          = std::pow(10.0, static_cast<double>(gain_db) / 40.0);
+    auto const s          = 2.0 * std::sqrt(a) * alpha;
+    return detail::normalize_biquad<Float>(
+        a * ((a + 1.0) - (a - 1.0) * c + s),
+        2.0 * a * ((a - 1.0) - (a + 1.0) * c),
+        a * ((a + 1.0) - (a - 1.0) * c - s),
+        (a + 1.0) + (a - 1.0) * c + s,
+        -2.0 * ((a - 1.0) + (a + 1.0) * c),
+        (a + 1.0) + (a - 1.0) * c - s
+    );
+}
+
+/// \ingroup neo-iir
+template<std::floating_point Float>
+[[nodiscard]] auto make_high_shelf(Float sample_rate, Float frequency, Float q, Float gain_db) noexcept
+    -> biquad_coefficients<Float>
+{
+    auto const [c, alpha] = detail::biquad_prototype(sample_rate, frequency, q);
+    auto const a          = std::pow(10.0, static_cast<double>(gain_db) / 40.0);
+    auto const s          = 2.0 * std::sqrt(a) * alpha;
+    return detail::normalize_biquad<Float>(
+        a * ((a + 1.0) + (a - 1.0) * c + s),
+        -2.0 * a * ((a - 1.0) + (a + 1.0) * c),
+        a * ((a + 1.0) + (a - 1.0) * c - s),
+        (a + 1.0) - (a - 1.0) * c + s,
+        2.0 * ((a - 1.0) - (a + 1.0) * c),
+        (a + 1.0) - (a - 1.0) * c - s
+    );
+}
+
+/// H(exp(i * w)) at the given frequency
+/// \ingroup neo-iir
+template<std::floating_point Float>
+[[nodiscard]] auto frequency_response(biquad_coefficients<Float> const& c, Float sample_rate, Float frequency) noexcept
+    -> std::complex<Float>
+{
+    auto const w   = std::numbers::pi * 2.0 * static_cast<double>(frequency) / static_cast<double>(sample_rate);
+    auto const z1  = std::polar(1.0, -w);
+    auto const z2  = z1 * z1;
+    auto const num = static_cast<double>(c.b0) + static_cast<double>(c.b1) * z1 + static_cast<double>(c.b2) * z2;
+    auto const den = 1.0 + static_cast<double>(c.a1) * z1 + static_cast<double>(c.a2) * z2;
+    auto const h   = num / den;
+    return {static_cast<Float>(h.real()), static_cast<Float>(h.imag())};
+}
+
+}  // namespace neo::iir
@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/container/mdspan.hpp>
+#include <neo/iir/biquad.hpp>
+#include <neo/simd/native.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace neo::iir {
+
+namespace detail {
+
+/// Transposed direct form II over frames of interleaved lanes, x is size x lanes.
+/// coefficients holds b0, b1, b2, a1 & a2 for every lane, state z1 & z2.
+template<std::floating_point Float>
+auto biquad_interleaved(
+    Float* NEO_RESTRICT x,
+    std::size_t lanes,
+    std::size_t size,
+    Float const* NEO_RESTRICT coefficients,
+    Float* NEO_RESTRICT state
+) noexcept -> void
+{
+    auto lane = 0zu;
+
+#if defined(NEO_HAS_ISA_SSE2)
+    if constexpr (std::same_as<Float, float> or std::same_as<Float, double>) {
+        using Batch = std::conditional_t<std::same_as<Float, float>, float32x, float64x>;
+
+        static constexpr auto width = Batch::size;
+
+        // Two independent recursions in flight hide the latency of the feedback path
+        for (; lane + width * 2zu <= lanes; lane += width * 2zu) {
+            auto const load = [&](std::size_t row, std::size_t offset) {
+                return Batch::load_unaligned(coefficients + row * lanes + lane + offset);
+            };
+
+            auto const b00 = load(0, 0), b10 = load(1, 0), b20 = load(2, 0), a10 = load(3, 0), a20 = load(4, 0);
+            auto const b01 = load(0, width), b11 = load(1, width), b21 = load(2, width);
+            auto const a11 = load(3, width), a21 = load(4, width);
+
+            auto z10 = Batch::load_unaligned(state + lane);
+            auto z11 = Batch::load_unaligned(state + lane + width);
+            auto z20 = Batch::load_unaligned(state + lanes + lane);
+            auto z21 = Batch::load_unaligned(state + lanes + lane + width);
+
+            for (auto n{0zu}; n < size; ++n) {
+                auto* const frame = x + n * lanes + lane;
+                auto const x0     = Batch::load_unaligned(frame);
+                auto const x1     = Batch::load_unaligned(frame + width);
+
+                auto const y0 = b00 * x0 + z10;
+                auto const y1 = b01 * x1 + z11;
+                z10           = b10 * x0 - a10 * y0 + z20;
+                z11           = b11 * x1 - a11 * y1 + z21;
+                z20           = b20 * x0 - a20 * y0;
+                z21           = b21 * x1 - a21 * y1;
+
+                y0.store_unaligned(frame);
+                y1.store_unaligned(frame + width);
+            }
+
+            z10.store_unaligned(state + lane);
+            z11.store_unaligned(state + lane + width);
+            z20.store_unaligned(state + lanes + lane);
+            z21.store_unaligned(state + lanes + lane + width);
+        }
+
+        for (; lane + width <= lanes; lane += width) {
+            auto const b0 = Batch::load_unaligned(coefficients + lane);
+            auto const b1 = Batch::load_unaligned(coefficients + lanes + lane);
+            auto const b2 = Batch::load_unaligned(coefficients + lanes * 2zu + lane);
+            auto const a1 = Batch::load_unaligned(coefficients + lanes * 3zu + lane);
+            auto const a2 = Batch::load_unaligned(coefficients + lanes * 4zu + lane);
+
+            auto z1 = Batch::load_unaligned(state + lane);
+            auto z2 = Batch::load_unaligned(state + lanes + lane);
+            for (auto n{0zu}; n < size; ++n) {
+                auto* const frame = x + n * lanes + lane;
+                auto const in     = Batch::load_unaligned(frame);
+                auto const y      = b0 * in + z1;
+                z1                = b1 * in - a1 * y + z2;
+                z2                = b2 * in - a2 * y;
+                y.store_unaligned(frame);
+            }
+            z1.store_unaligned(state + lane);
+            z2.store_unaligned(state + lanes + lane);
+        }
+    }
+#endif
+
+    for (; lane < lanes; ++lane) {
+        auto const b0 = coefficients[lane];
+        auto const b1 = coefficients[lanes + lane];
+        auto const b2 = coefficients[lanes * 2zu + lane];
+        auto const a1 = coefficients[lanes * 3zu + lane];
+        auto const a2 = coefficients[lanes * 4zu + lane];
+
+        auto z1 = state[lane];
+        auto z2 = state[lanes + lane];
+        for (auto n{0zu}; n < size; ++n) {
+            auto const in       = x[n * lanes + lane];
+            auto const y        = b0 * in + z1;
+            z1                  = b1 * in - a1 * y + z2;
+            z2                  = b2 * in - a2 * y;
+            x[n * lanes + lane] = y;
+        }
+        state[lane]         = z1;
+        state[lanes + lane] = z2;
+    }
+}
+
+/// Number of interleaved lanes for the channels, a multiple of the native vector width
+template<std::floating_point Float>
+[[nodiscard]] constexpr auto biquad_lanes(std::size_t num_channels) noexcept -> std::size_t
+{
+#if defined(NEO_HAS_ISA_SSE2)
+    if constexpr (std::same_as<Float, float> or std::same_as<Float, double>) {
+        using Batch = std::conditional_t<std::same_as<Float, float>, float32x, float64x>;
+        return (num_channels + Batch::size - 1zu) / Batch::size * Batch::size;
+    }
+#endif
+    return num_channels;
+}
+
+}  // namespace detail
+
+/// Cascade of biquads for many channels, in transposed direct form II.
+///
+/// The channels are interleaved into SIMD lanes, so all channels run through a
+/// stage with the instructions of one. Up to two vectors of channels are in
+/// flight at once, to hide the latency of the feedback path. Every channel
+/// can have its own coefficients. For a single channel use lookahead_biquad_cascade.
+///
+/// \ingroup neo-iir
+template<std::floating_point Float>
+struct biquad_cascade
+{
+    using value_type = Float;
+    using size_type  = std::size_t;
+
+    biquad_cascade(size_type num_channels, size_type num_stages);
+
+    [[nodiscard]] auto num_channels() const noexcept -> size_type { return _num_channels; }
+
+    [[nodiscard]] auto num_stages() const noexcept -> size_type { return _num_stages; }
+
+    [[nodiscard]] auto coefficients(size_type channel, size_type stage) const noexcept -> biquad_coefficients<Float>;
+
+    /// Sets the stage of every channel
+    auto set_coefficients(size_type stage, biquad_coefficients<Float> const& coefficients) noexcept -> void;
+
+    auto set_coefficients(size_type channel, size_type stage, biquad_coefficients<Float> const& coefficients) noexcept
+        -> void;
+
+    auto reset() noexcept -> void;
+
+    /// Filters channels x frames in place
+    template<inout_matrix Mat>
+        requires std::same_as<value_type_t<Mat>, Float>
+    auto operator()(Mat block) noexcept -> void;
+
+private:
+    static constexpr auto chunk_size = 64zu;
+
+    [[nodiscard]] auto lanes() const noexcept -> size_type { return _interleaved.size() / chunk_size; }
+
+    size_type _num_channels;
+    size_type _num_stages;
+
+    // Per stage b0, b1, b2, a1, a2 & z1, z2, each with one value per lane
+    std::vector<Float> _coefficients;
+    std::vector<Float> _state;
+    std::vector<Float> _interleaved;
+};
+
+template<std::floating_point Float>
+biquad_cascade<Float>::biquad_cascade(size_type num_channels, size_type num_stages)
+    : _num_channels{num_channels}
+    , _num_stages{num_stages}
+    , _coefficients(detail::biquad_lanes<Float>(num_channels) * num_stages * 5zu)
+    , _state(detail::biquad_lanes<Float>(num_channels) * num_stages * 2zu)
+    , _interleaved(detail::biquad_lanes<Float>(num_channels) * chunk_size)
+{
+    for (auto stage{0zu}; stage < num_stages; ++stage) {
+        set_coefficients(stage, biquad_coefficients<Float>{});
+    }
+}
+
+template<std::floating_point Float>
+auto biquad_cascade<Float>::coefficients(size_type channel, size_type stage) const noexcept
+    -> biquad_coefficients<Float>
+{
+    assert(channel < num_channels());
+    assert(stage < num_stages());
+
+    auto const* c = _coefficients.data() + stage * lanes() * 5zu + channel;
+    return {
+        .b0 = c[0],
+        .b1 = c[lanes()],
+        .b2 = c[lanes() * 2zu],
+        .a1 = c[lanes() * 3zu],
+        .a2 = c[lanes() * 4zu],
+    };
+}
+
+template<std::floating_point Float>
+auto biquad_cascade<Float>::set_coefficients(size_type stage, biquad_coefficients<Float> const& coefficients) noexcept
+    -> void
+{
+    for (auto channel{0zu}; channel < num_channels(); ++channel) {
+        set_coefficients(channel, stage, coefficients);
+    }
+}
+
+template<std::floating_point Float>
+auto biquad_cascade<Float>::set_coefficients(
+    size_type channel,
+    size_type stage,
+    biquad_coefficients<Float> const& coefficients
+) noexcept -> void
+{
+    assert(channel < num_channels());
+    assert(stage < num_stages());
+
+    auto* c          = _coefficients.data() + stage * lanes() * 5zu + channel;
+    c[0]             = coefficients.b0;
+    c[lanes()]       = coefficients.b1;
+    c[lanes() * 2zu] = coefficients.b2;
+    c[lanes() * 3zu] = coefficients.a1;
+    c[lanes() * 4zu] = coefficients.a2;
+}
+
+template<std::floating_point Float>
+auto biquad_cascade<Float>::reset() noexcept -> void
+{
+    std::fill(_state.begin(), _state.end(), Float(0));
+}
+
+template<std::floating_point Float>
+template<inout_matrix Mat>
+    requires std::same_as<value_type_t<Mat>, Float>
+auto biquad_cascade<Float>::operator()(Mat block) noexcept -> void
+{
+    assert(std::cmp_equal(block.extent(0), num_channels()));
+
+    auto const lanes = this->lanes();
+    auto* const x    = _interleaved.data();
+
+    for (auto offset{0zu}; offset < block.extent(1); offset += chunk_size) {
+        auto const size = std::min(chunk_size, block.extent(1) - offset);
+        for (auto ch{0zu}; ch < num_channels(); ++ch) {
+            for (auto n{0zu}; n < size; ++n) {
+                x[n * lanes + ch] = block(ch, offset + n);
+            }
+        }
+
+        for (auto stage{0zu}; stage < num_stages(); ++stage) {
+            auto const* coefficients = _coefficients.data() + stage * lanes * 5zu;
+            detail::biquad_interleaved(x, lanes, size, coefficients, _state.data() + stage * lanes * 2zu);
+        }
+
+        for (auto ch{0zu}; ch < num_channels(); ++ch) {
+            for (auto n{0zu}; n < size; ++n) {
+                block(ch, offset + n) = x[n * lanes + ch];
+            }
+        }
+    }
+}
+
+}  // namespace neo::iir
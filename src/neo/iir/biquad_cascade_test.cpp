@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: MIT
+
+#include "biquad_cascade.hpp"
+
+#include <neo/algorithm/allclose.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <tuple>
+
+namespace {
+
+/// Transposed direct form II in double
+template<typename Float, std::size_t NumStages>
+auto reference_cascade(
+    std::array<neo::iir::biquad_coefficients<Float>, NumStages> const& stages,
+    Float const* x,
+    Float* y,
+    std::size_t size
+) -> void
+{
+    std::copy(x, x + size, y);
+    for (auto const& c : stages) {
+        auto const b0 = static_cast<double>(c.b0);
+        auto const b1 = static_cast<double>(c.b1);
+        auto const b2 = static_cast<double>(c.b2);
+        auto const a1 = static_cast<double>(c.a1);
+        auto const a2 = static_cast<double>(c.a2);
+
+        auto z1 = 0.0;
+        auto z2 = 0.0;
+        for (auto n{0zu}; n < size; ++n) {
+            auto const in  = static_cast<double>(y[n]);
+            auto const out = b0 * in + z1;
+            z1             = b1 * in - a1 * out + z2;
+            z2             = b2 * in - a2 * out;
+            y[n]           = static_cast<Float>(out);
+        }
+    }
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/iir: biquad_cascade", "", float, double)
+{
+    using Float = TestType;
+
+    auto const num_channels = GENERATE(as<std::size_t>{}, 1, 2, 3, 8, 17);
+    auto const block_size   = GENERATE(as<std::size_t>{}, 1, 63, 64, 500);
+    CAPTURE(num_channels, block_size);
+
+    static constexpr auto size = 2000zu;
+
+    // Every channel gets its own filters, detuned by the channel index
+    auto stages = std::vector<std::array<neo::iir::biquad_coefficients<Float>, 3>>{};
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        auto const detune = Float(1) + static_cast<Float>(ch) / Float(10);
+        stages.push_back({
+            neo::iir::make_lowpass(Float(48'000), Float(50) * detune, Float(0.7)),
+            neo::iir::make_peak(Float(48'000), Float(1'000) * detune, Float(2), Float(6)),
+            neo::iir::make_high_shelf(Float(48'000), Float(5'000), Float(0.7), Float(-4) * detune),
+        });
+    }
+
+    auto filter = neo::iir::biquad_cascade<Float>{num_channels, 3};
+    REQUIRE(filter.num_channels() == num_channels);
+    REQUIRE(filter.num_stages() == 3);
+    REQUIRE(filter.coefficients(num_channels - 1zu, 2) == neo::iir::biquad_coefficients<Float>{});
+
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        for (auto stage{0zu}; stage < 3zu; ++stage) {
+            filter.set_coefficients(ch, stage, stages[ch][stage]);
+        }
+    }
+    REQUIRE(filter.coefficients(num_channels - 1zu, 1) == stages.back()[1]);
+
+    auto signal = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_channels, size};
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        auto const noise = neo::generate_noise_signal<Float>(size, Catch::getSeed() + static_cast<std::uint32_t>(ch));
+        for (auto i{0zu}; i < size; ++i) {
+            signal(ch, i) = noise(i);
+        }
+    }
+
+    auto expected = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_channels, size};
+    for (auto ch{0zu}; ch < num_channels; ++ch) {
+        reference_cascade(stages[ch], &signal(ch, 0), &expected(ch, 0), size);
+    }
+
+    // Filtering twice after a reset gives the same result
+    for (auto pass{0}; pass < 2; ++pass) {
+        auto output = signal;
+        for (auto i{0zu}; i < size; i += block_size) {
+            auto const end = std::min(i + block_size, size);
+            filter(stdex::submdspan(output.to_mdspan(), stdex::full_extent, std::tuple{i, end}));
+        }
+
+        for (auto ch{0zu}; ch < num_channels; ++ch) {
+            for (auto i{0zu}; i < size; ++i) {
+                REQUIRE_THAT(output(ch, i), Catch::Matchers::WithinAbs(expected(ch, i), 1e-4));
+            }
+        }
+        filter.reset();
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/iir: biquad_cascade(bypass)", "", float, double)
+{
+    using Float = TestType;
+
+    auto filter = neo::iir::biquad_cascade<Float>{5, 2};
+    auto signal = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{5, 100};
+    for (auto ch{0zu}; ch < 5zu; ++ch) {
+        for (auto i{0zu}; i < 100zu; ++i) {
+            signal(ch, i) = static_cast<Float>(ch * 100zu + i);
+        }
+    }
+
+    auto output = signal;
+    filter(output.to_mdspan());
+    REQUIRE(neo::allclose(output.to_mdspan(), signal.to_mdspan()));
+}
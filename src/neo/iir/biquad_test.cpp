@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+
+#include "biquad.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+
+namespace {
+
+template<typename Float>
+auto gain_db(neo::iir::biquad_coefficients<Float> const& c, Float frequency) -> Float
+{
+    return Float(20) * std::log10(std::abs(neo::iir::frequency_response(c, Float(48'000), frequency)));
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/iir: biquad_coefficients", "", float, double)
+{
+    using Float = TestType;
+
+    auto const bypass = neo::iir::biquad_coefficients<Float>{};
+    REQUIRE(bypass.b0 == Float(1));
+    REQUIRE(gain_db(bypass, Float(1'000)) == Catch::Approx(0.0).margin(1e-5));
+    REQUIRE(bypass == neo::iir::biquad_coefficients<Float>{});
+    REQUIRE(bypass != neo::iir::make_lowpass(Float(48'000), Float(1'000), Float(1)));
+}
+
+TEMPLATE_TEST_CASE("neo/iir: make_lowpass", "", float, double)
+{
+    using Float = TestType;
+
+    auto const q  = static_cast<Float>(std::numbers::sqrt2 / 2.0);
+    auto const lp = neo::iir::make_lowpass(Float(48'000), Float(1'000), q);
+    REQUIRE(gain_db(lp, Float(10)) == Catch::Approx(0.0).margin(0.01));
+    REQUIRE(gain_db(lp, Float(1'000)) == Catch::Approx(-3.0103).margin(0.01));
+    REQUIRE(gain_db(lp, Float(10'000)) < Float(-38));
+
+    auto const hp = neo::iir::make_highpass(Float(48'000), Float(1'000), q);
+    REQUIRE(gain_db(hp, Float(20'000)) == Catch::Approx(0.0).margin(0.01));
+    REQUIRE(gain_db(hp, Float(1'000)) == Catch::Approx(-3.0103).margin(0.01));
+    REQUIRE(gain_db(hp, Float(100)) < Float(-38));
+}
+
+TEMPLATE_TEST_CASE("neo/iir: make_bandpass", "", float, double)
+{
+    using Float = TestType;
+
+    auto const bp = neo::iir::make_bandpass(Float(48'000), Float(2'000), Float(4));
+    REQUIRE(gain_db(bp, Float(2'000)) == Catch::Approx(0.0).margin(0.01));
+    REQUIRE(gain_db(bp, Float(200)) < Float(-20));
+    REQUIRE(gain_db(bp, Float(20'000)) < Float(-20));
+
+    auto const notch = neo::iir::make_notch(Float(48'000), Float(2'000), Float(4));
+    REQUIRE(std::abs(neo::iir::frequency_response(notch, Float(48'000), Float(2'000))) < Float(1e-3));
+    REQUIRE(gain_db(notch, Float(200)) == Catch::Approx(0.0).margin(0.01));
+}
+
+TEMPLATE_TEST_CASE("neo/iir: make_peak", "", float, double)
+{
+    using Float = TestType;
+
+    auto const boost = neo::iir::make_peak(Float(48'000), Float(1'000), Float(2), Float(6));
+    REQUIRE(gain_db(boost, Float(1'000)) == Catch::Approx(6.0).margin(0.01));
+    REQUIRE(gain_db(boost, Float(20)) == Catch::Approx(0.0).margin(0.01));
+
+    auto const cut = neo::iir::make_peak(Float(48'000), Float(1'000), Float(2), Float(-12));
+    REQUIRE(gain_db(cut, Float(1'000)) == Catch::Approx(-12.0).margin(0.01));
+}
+
+TEMPLATE_TEST_CASE("neo/iir: make_shelf", "", float, double)
+{
+    using Float = TestType;
+
+    auto const q   = static_cast<Float>(std::numbers::sqrt2 / 2.0);
+    auto const low = neo::iir::make_low_shelf(Float(48'000), Float(200), q, Float(-6));
+    REQUIRE(gain_db(low, Float(10)) == Catch::Approx(-6.0).margin(0.01));
+    REQUIRE(gain_db(low, Float(200)) == Catch::Approx(-3.0).margin(0.01));
+    REQUIRE(gain_db(low, Float(10'000)) == Catch::Approx(0.0).margin(0.01));
+
+    auto const high = neo::iir::make_high_shelf(Float(48'000), Float(5'000), q, Float(4));
+    REQUIRE(gain_db(high, Float(23'000)) == Catch::Approx(4.0).margin(0.05));
+    REQUIRE(gain_db(high, Float(5'000)) == Catch::Approx(2.0).margin(0.01));
+    REQUIRE(gain_db(high, Float(50)) == Catch::Approx(0.0).margin(0.01));
+}
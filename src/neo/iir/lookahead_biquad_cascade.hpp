@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/container/mdspan.hpp>
+#include <neo/iir/biquad.hpp>
+#include <neo/simd/native.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace neo::iir {
+
+namespace detail {
+
+/// Look-ahead distance M, the native vector width
+template<std::floating_point Float>
+[[nodiscard]] constexpr auto lookahead_distance() noexcept -> std::size_t
+{
+#if defined(NEO_HAS_ISA_SSE2)
+    if constexpr (std::same_as<Float, float> or std::same_as<Float, double>) {
+        using Batch = std::conditional_t<std::same_as<Float, float>, float32x, float64x>;
+        return Batch::size;
+    }
+#endif
+    return 4;
+}
+
+/// Rewrites the biquad as y[n] = sum_j taps[j] * x[n - j] - c1 * y[n - M] - c2 * y[n - 2M].
+///
+/// Scattered look-ahead: the denominator is multiplied by P(z), which adds the poles
+/// p * exp(2i * pi * k / M) for k in [1, M) & cancels them again in the numerator.
+/// With the poles p0 & p1 the new denominator is (1 - p0^M * z^-M) * (1 - p1^M * z^-M).
+/// Returns the 2M + 1 taps, c1 & c2.
+template<std::size_t M>
+[[nodiscard]] auto make_lookahead_biquad(biquad_coefficients<double> const& c)
+    -> std::tuple<std::array<double, M * 2 + 1>, double, double>
+{
+    // Impulse response of 1 / A(z) & power sums p0^k + p1^k
+    auto h = std::array<double, M * 2 - 1>{};
+    auto t = std::array<double, M + 1>{};
+    h[0]   = 1.0;
+    h[1]   = -c.a1;
+    t[0]   = 2.0;
+    t[1]   = -c.a1;
+    for (auto k{2zu}; k < h.size(); ++k) {
+        h[k] = -c.a1 * h[k - 1] - c.a2 * h[k - 2];
+    }
+    for (auto k{2zu}; k < t.size(); ++k) {
+        t[k] = -c.a1 * t[k - 1] - c.a2 * t[k - 2];
+    }
+
+    auto const c1 = -t[M];
+    auto c2       = 1.0;
+    for (auto k{0zu}; k < M; ++k) {
+        c2 *= c.a2;
+    }
+
+    // P(z) = (1 + c1 * z^-M + c2 * z^-2M) / A(z), a polynomial of degree 2M - 2
+    auto p = h;
+    for (auto k{M}; k < p.size(); ++k) {
+        p[k] += c1 * h[k - M];
+    }
+
+    auto const b = std::array{c.b0, c.b1, c.b2};
+    auto taps    = std::array<double, M * 2 + 1>{};
+    for (auto i{0zu}; i < b.size(); ++i) {
+        for (auto k{0zu}; k < p.size(); ++k) {
+            taps[i + k] += b[i] * p[k];
+        }
+    }
+
+    return {taps, c1, c2};
+}
+
+/// y[n] = sum_j taps[j] * x[n - j] - c1 * y[n - M] - c2 * y[n - 2M] for n in [0, size).
+/// x & y are preceded by 2M samples of history.
+template<std::size_t M, std::floating_point Float>
+auto lookahead_biquad(
+    Float const* NEO_RESTRICT x,
+    Float* NEO_RESTRICT y,
+    Float const* NEO_RESTRICT taps,
+    Float c1,
+    Float c2,
+    std::size_t size
+) noexcept -> void
+{
+    static constexpr auto num_taps = M * 2zu + 1zu;
+
+    auto n = 0zu;
+
+#if defined(NEO_HAS_ISA_SSE2)
+    if constexpr (std::same_as<Float, float> or std::same_as<Float, double>) {
+        using Batch = std::conditional_t<std::same_as<Float, float>, float32x, float64x>;
+        static_assert(Batch::size == M);
+
+        // M outputs at once only depend on the two previous vectors of outputs
+        auto const nc1 = Batch::broadcast(-c1);
+        auto const nc2 = Batch::broadcast(-c2);
+        auto y2        = Batch::load_unaligned(y - M * 2zu);
+        auto y1        = Batch::load_unaligned(y - M);
+        for (; n + M <= size; n += M) {
+            auto acc = nc1 * y1 + nc2 * y2;
+            for (auto j{0zu}; j < num_taps; ++j) {
+                acc = acc + Batch::broadcast(taps[j]) * Batch::load_unaligned(x + n - j);
+            }
+            acc.store_unaligned(y + n);
+            y2 = y1;
+            y1 = acc;
+        }
+    }
+#endif
+
+    for (; n < size; ++n) {
+        auto acc = -c1 * y[n - M] - c2 * y[n - M * 2zu];
+        for (auto j{0zu}; j < num_taps; ++j) {
+            acc += taps[j] * x[n - j];
+        }
+        y[n] = acc;
+    }
+}
+
+}  // namespace detail
+
+/// Cascade of biquads for a single channel, vectorized along time.
+///
+/// The feedback of a biquad allows no parallelism between neighbouring samples. Every
+/// stage is rewritten with scattered look-ahead, so each output only depends on outputs
+/// M & 2M samples back, where M is the native vector width. A vector of M outputs is then a
+/// FIR of 2M + 1 taps plus two vectors of previous outputs. The extra poles are canceled
+/// exactly in double, but rounding the taps to float leaves errors that grow as the poles
+/// approach the unit circle. For many channels use biquad_cascade.
+///
+/// \ingroup neo-iir
+template<std::floating_point Float>
+struct lookahead_biquad_cascade
+{
+    using value_type = Float;
+    using size_type  = std::size_t;
+
+    explicit lookahead_biquad_cascade(size_type num_stages);
+
+    [[nodiscard]] auto num_stages() const noexcept -> size_type { return _coefficients.size(); }
+
+    [[nodiscard]] auto coefficients(size_type stage) const noexcept -> biquad_coefficients<Float>
+    {
+        assert(stage < num_stages());
+        return _coefficients[stage];
+    }
+
+    auto set_coefficients(size_type stage, biquad_coefficients<Float> const& coefficients) -> void;
+
+    auto reset() noexcept -> void;
+
+    /// Filters x in place
+    template<inout_vector_of<Float> InOutVec>
+    auto operator()(InOutVec x) noexcept -> void;
+
+private:
+    static constexpr auto distance   = detail::lookahead_distance<Float>();
+    static constexpr auto num_taps   = distance * 2zu + 1zu;
+    static constexpr auto history    = distance * 2zu;
+    static constexpr auto chunk_size = 256zu;
+
+    std::vector<biquad_coefficients<Float>> _coefficients;
+
+    // Per stage 2M + 1 taps, followed by c1 & c2
+    std::vector<Float> _taps;
+
+    // num_stages() + 1 buffers of 2M history & the current chunk, stage i reads buffer i & writes buffer i + 1
+    std::vector<Float> _buffers;
+};
+
+template<std::floating_point Float>
+lookahead_biquad_cascade<Float>::lookahead_biquad_cascade(size_type num_stages)
+    : _coefficients(num_stages)
+    , _taps(num_stages * (num_taps + 2zu))
+    , _buffers((num_stages + 1zu) * (history + chunk_size))
+{
+    for (auto stage{0zu}; stage < num_stages; ++stage) {
+        set_coefficients(stage, biquad_coefficients<Float>{});
+    }
+}
+
+template<std::floating_point Float>
+auto lookahead_biquad_cascade<Float>::set_coefficients(
+    size_type stage,
+    biquad_coefficients<Float> const& coefficients
+) -> void
+{
+    assert(stage < num_stages());
+
+    auto const [taps, c1, c2] = detail::make_lookahead_biquad<distance>({
+        .b0 = static_cast<double>(coefficients.b0),
+        .b1 = static_cast<double>(coefficients.b1),
+        .b2 = static_cast<double>(coefficients.b2),
+        .a1 = static_cast<double>(coefficients.a1),
+        .a2 = static_cast<double>(coefficients.a2),
+    });
+
+    auto* out = _taps.data() + stage * (num_taps + 2zu);
+    for (auto j{0zu}; j < num_taps; ++j) {
+        out[j] = static_cast<Float>(taps[j]);
+    }
+    out[num_taps]       = static_cast<Float>(c1);
+    out[num_taps + 1zu] = static_cast<Float>(c2);
+
+    _coefficients[stage] = coefficients;
+}
+
+template<std::floating_point Float>
+auto lookahead_biquad_cascade<Float>::reset() noexcept -> void
+{
+    std::fill(_buffers.begin(), _buffers.end(), Float(0));
+}
+
+template<std::floating_point Float>
+template<inout_vector_of<Float> InOutVec>
+auto lookahead_biquad_cascade<Float>::operator()(InOutVec x) noexcept -> void
+{
+    static constexpr auto stride = history + chunk_size;
+
+    auto* const first = _buffers.data() + history;
+    auto* const last  = first + num_stages() * stride;
+
+    for (auto offset{0zu}; offset < x.extent(0); offset += chunk_size) {
+        auto const size = std::min(chunk_size, x.extent(0) - offset);
+        for (auto i{0zu}; i < size; ++i) {
+            first[i] = x[offset + i];
+        }
+
+        for (auto stage{0zu}; stage < num_stages(); ++stage) {
+            auto const* taps = _taps.data() + stage * (num_taps + 2zu);
+            auto* const in   = first + stage * stride;
+            auto* const out  = in + stride;
+            detail::lookahead_biquad<distance>(in, out, taps, taps[num_taps], taps[num_taps + 1zu], size);
+        }
+
+        for (auto i{0zu}; i < size; ++i) {
+            x[offset + i] = last[i];
+        }
+
+        // The last 2M samples of every buffer become its history
+        for (auto buffer{0zu}; buffer <= num_stages(); ++buffer) {
+            auto* const end = first + buffer * stride + size;
+            std::copy(end - history, end, end - size - history);
+        }
+    }
+}
+
+}  // namespace neo::iir
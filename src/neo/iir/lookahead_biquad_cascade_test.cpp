@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: MIT
+
+#include "lookahead_biquad_cascade.hpp"
+
+#include <neo/algorithm/allclose.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+namespace {
+
+/// Transposed direct form II in double
+template<typename Float, std::size_t NumStages>
+auto reference_cascade(
+    std::array<neo::iir::biquad_coefficients<Float>, NumStages> const& stages,
+    Float const* x,
+    Float* y,
+    std::size_t size
+) -> void
+{
+    std::copy(x, x + size, y);
+    for (auto const& c : stages) {
+        auto const b0 = static_cast<double>(c.b0);
+        auto const b1 = static_cast<double>(c.b1);
+        auto const b2 = static_cast<double>(c.b2);
+        auto const a1 = static_cast<double>(c.a1);
+        auto const a2 = static_cast<double>(c.a2);
+
+        auto z1 = 0.0;
+        auto z2 = 0.0;
+        for (auto n{0zu}; n < size; ++n) {
+            auto const in  = static_cast<double>(y[n]);
+            auto const out = b0 * in + z1;
+            z1             = b1 * in - a1 * out + z2;
+            z2             = b2 * in - a2 * out;
+            y[n]           = static_cast<Float>(out);
+        }
+    }
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/iir: lookahead_biquad_cascade", "", float, double)
+{
+    using Float = TestType;
+
+    // Poles close to the unit circle are the worst case for the look-ahead form
+    auto const cutoff     = GENERATE(Float(20), Float(200), Float(5'000));
+    auto const block_size = GENERATE(as<std::size_t>{}, 1, 3, 255, 256, 1000);
+    CAPTURE(cutoff, block_size);
+
+    static constexpr auto size = 3000zu;
+
+    auto const stages = std::array{
+        neo::iir::make_lowpass(Float(48'000), cutoff, Float(0.7)),
+        neo::iir::make_highpass(Float(48'000), cutoff / Float(4), Float(0.5)),
+        neo::iir::make_peak(Float(48'000), Float(1'000), Float(2), Float(6)),
+        neo::iir::make_notch(Float(48'000), Float(10'000), Float(4)),
+    };
+
+    auto filter = neo::iir::lookahead_biquad_cascade<Float>{stages.size()};
+    REQUIRE(filter.num_stages() == stages.size());
+    REQUIRE(filter.coefficients(0) == neo::iir::biquad_coefficients<Float>{});
+
+    for (auto stage{0zu}; stage < stages.size(); ++stage) {
+        filter.set_coefficients(stage, stages[stage]);
+    }
+    REQUIRE(filter.coefficients(2) == stages[2]);
+
+    auto const signal = neo::generate_noise_signal<Float>(size, Catch::getSeed());
+    auto expected     = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+    reference_cascade(stages, signal.data(), expected.data(), size);
+
+    // Filtering twice after a reset gives the same result
+    for (auto pass{0}; pass < 2; ++pass) {
+        auto output = signal;
+        for (auto i{0zu}; i < size; i += block_size) {
+            filter(stdex::submdspan(output.to_mdspan(), std::tuple{i, std::min(i + block_size, size)}));
+        }
+
+        for (auto i{0zu}; i < size; ++i) {
+            REQUIRE_THAT(output(i), Catch::Matchers::WithinAbs(expected(i), 1e-4));
+        }
+        filter.reset();
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/iir: lookahead_biquad_cascade(bypass)", "", float, double)
+{
+    using Float = TestType;
+
+    auto filter       = neo::iir::lookahead_biquad_cascade<Float>{3};
+    auto const signal = neo::generate_noise_signal<Float>(1000, Catch::getSeed());
+
+    auto output = signal;
+    filter(output.to_mdspan());
+    REQUIRE(neo::allclose(output.to_mdspan(), signal.to_mdspan()));
+}
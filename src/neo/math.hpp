@@ -21,4 +21,5 @@
 #include <neo/math/polar.hpp>
 #include <neo/math/precision.hpp>
 #include <neo/math/real.hpp>
+#include <neo/math/sincos.hpp>
 #include <neo/math/windowing.hpp>
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <bit>
 #include <cstdint>
 
@@ -23,4 +24,47 @@ namespace neo {
     return fast_log2(x) * scale;
 }
 
+/// Polynomial approximation without branches or divisions, so loops over it vectorize.
+/// Absolute error below 1e-5, x must be a positive normal number.
+/// \ingroup neo-math
+[[nodiscard]] constexpr auto fast_log2_polynomial(float x) noexcept -> float
+{
+    // x = m * 2^e with m in [1, 2), log2(m) = t * p(t) with t = m - 1
+    auto const vx = std::bit_cast<std::uint32_t>(x);
+    auto const e  = static_cast<float>(static_cast<std::int32_t>(vx >> 23U) - 127);
+    auto const t  = std::bit_cast<float>((vx & 0x007FFFFFU) | 0x3F800000U) - 1.0F;
+
+    auto p = -0.034595210F;
+    p      = p * t + 0.14643361F;
+    p      = p * t - 0.30338967F;
+    p      = p * t + 0.46930169F;
+    p      = p * t - 0.72044237F;
+    p      = p * t + 1.4426833F;
+    return e + t * p;
+}
+
+/// Polynomial approximation of 2^x without branches, relative error below 3e-6.
+/// x is clamped to [-126, 127].
+/// \ingroup neo-math
+[[nodiscard]] constexpr auto fast_exp2(float x) noexcept -> float
+{
+    // Adding 1.5 * 2^23 rounds to the nearest integer n, which ends up in the low mantissa bits
+    constexpr auto magic = 12582912.0F;
+
+    auto const clamped = std::min(std::max(x, -126.0F), 127.0F);
+    auto const shifted = clamped + magic;
+    auto const t       = clamped - (shifted - magic);
+    auto const n       = std::bit_cast<std::uint32_t>(shifted) - std::bit_cast<std::uint32_t>(magic);
+
+    // 2^t with t in [-0.5, 0.5]
+    auto p = 0.0095605102F;
+    p      = p * t + 0.055917039F;
+    p      = p * t + 0.24024981F;
+    p      = p * t + 0.69312197F;
+    p      = p * t + 0.99999919F;
+
+    // 2^n built directly from the exponent bits
+    return std::bit_cast<float>((n + 127U) << 23U) * p;
+}
+
 }  // namespace neo
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/container/mdspan.hpp>
+#include <neo/math/precision.hpp>
+
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <numbers>
+#include <type_traits>
+#include <utility>
+
+namespace neo {
+
+namespace detail {
+
+/// sin & cos with a branch-free range reduction & polynomial, so loops over it vectorize.
+/// The angle is reduced to r in [-pi/4, pi/4] around the nearest multiple q of pi/2, which selects
+/// the quadrant. Double uses the cephes sin/cos polynomials, float the ones from cephes sinf/cosf.
+template<std::floating_point Real>
+[[nodiscard]] constexpr auto sincos_kernel(Real x) noexcept -> std::pair<Real, Real>
+{
+    using Bits = std::conditional_t<std::same_as<Real, double>, std::uint64_t, std::uint32_t>;
+
+    static constexpr auto sign_shift = sizeof(Real) * 8U - 2U;
+
+    // Adding 1.5 * 2^mantissa rounds to the nearest integer, which ends up in the low mantissa bits
+    auto const magic   = std::same_as<Real, double> ? Real(6755399441055744.0) : Real(12582912.0);
+    auto const shifted = x * (Real(2) / std::numbers::pi_v<Real>) + magic;
+    auto const q       = std::bit_cast<Bits>(shifted) - std::bit_cast<Bits>(magic);
+    auto const n       = shifted - magic;
+
+    auto r = x;
+    auto s = Real(0);
+    auto c = Real(0);
+    if constexpr (std::same_as<Real, double>) {
+        // pi/2 split into 33 + 53 bits, n * hi is exact for |n| < 2^20
+        r = (r - n * 1.57079632673412561417e+00) - n * 6.07710050650619224932e-11;
+
+        auto const z = r * r;
+        auto ps      = 1.58962301576546568060e-10;
+        ps           = ps * z - 2.50507477628578072866e-8;
+        ps           = ps * z + 2.75573136213857245213e-6;
+        ps           = ps * z - 1.98412698295895385996e-4;
+        ps           = ps * z + 8.33333333332211858878e-3;
+        ps           = ps * z - 1.66666666666666307295e-1;
+
+        auto pc = -1.13585365213876817300e-11;
+        pc      = pc * z + 2.08757008419747316778e-9;
+        pc      = pc * z - 2.75573141792967388112e-7;
+        pc      = pc * z + 2.48015872888517045348e-5;
+        pc      = pc * z - 1.38888888888730564116e-3;
+        pc      = pc * z + 4.16666666666665929218e-2;
+
+        s = r + r * z * ps;
+        c = 1.0 - 0.5 * z + z * z * pc;
+    } else {
+        r = ((r - n * 1.5703125F) - n * 4.837512969970703125e-4F) - n * 7.54978995489188216e-8F;
+
+        auto const z = r * r;
+        auto ps      = -1.9515295891e-4F;
+        ps           = ps * z + 8.3321608736e-3F;
+        ps           = ps * z - 1.6666654611e-1F;
+
+        auto pc = 2.443315711809948e-5F;
+        pc      = pc * z - 1.388731625493765e-3F;
+        pc      = pc * z + 4.166664568298827e-2F;
+
+        s = r + r * z * ps;
+        c = 1.0F - 0.5F * z + z * z * pc;
+    }
+
+    // Odd quadrants swap sin & cos, the second bit of q (and q + 1) flips the sign
+    auto const swap = (q & Bits(1)) != 0;
+    auto const sin  = swap ? c : s;
+    auto const cos  = swap ? s : c;
+    return {
+        std::bit_cast<Real>(std::bit_cast<Bits>(sin) ^ ((q & Bits(2)) << sign_shift)),
+        std::bit_cast<Real>(std::bit_cast<Bits>(cos) ^ (((q + Bits(1)) & Bits(2)) << sign_shift)),
+    };
+}
+
+}  // namespace detail
+
+/// Returns {sin(x), cos(x)} without branches, so loops over it vectorize.
+/// precision::accurate evaluates in double (error below 1e-15 for |x| < 2^20),
+/// precision::estimate in float (error below 1e-6 for the angle rounded to float).
+/// \ingroup neo-math
+template<precision Precision = precision::accurate, std::floating_point Float>
+[[nodiscard]] constexpr auto fast_sincos(Float x) noexcept -> std::pair<Float, Float>
+{
+    using Real = std::conditional_t<Precision == precision::accurate, double, float>;
+
+    auto const [s, c] = detail::sincos_kernel(static_cast<Real>(x));
+    return {static_cast<Float>(s), static_cast<Float>(c)};
+}
+
+/// sin & cos of every angle
+/// \ingroup neo-math
+template<precision Precision = precision::accurate, in_vector InVec, out_vector OutSin, out_vector OutCos>
+    requires(std::floating_point<value_type_t<InVec>>)
+auto sincos(InVec x, OutSin sin, OutCos cos) noexcept -> void
+{
+    assert(x.extent(0) == sin.extent(0));
+    assert(x.extent(0) == cos.extent(0));
+
+    for (auto i{0zu}; i < static_cast<std::size_t>(x.extent(0)); ++i) {
+        auto const [s, c] = fast_sincos<Precision>(x[i]);
+        sin[i]            = static_cast<value_type_t<OutSin>>(s);
+        cos[i]            = static_cast<value_type_t<OutCos>>(c);
+    }
+}
+
+}  // namespace neo
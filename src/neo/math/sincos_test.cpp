@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: MIT
+
+#include "sincos.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+TEMPLATE_TEST_CASE("neo/math: fast_sincos", "", float, double)
+{
+    using Float = TestType;
+
+    auto const pi = std::numbers::pi_v<Float>;
+
+    SECTION("accurate")
+    {
+        auto const tolerance = std::same_as<Float, double> ? 1e-15 : 1e-7;
+        for (auto i{-20000}; i <= 20000; ++i) {
+            auto const x      = static_cast<Float>(i) * Float(0.0137);
+            auto const [s, c] = neo::fast_sincos(x);
+            REQUIRE_THAT(s, Catch::Matchers::WithinAbs(std::sin(x), tolerance));
+            REQUIRE_THAT(c, Catch::Matchers::WithinAbs(std::cos(x), tolerance));
+        }
+    }
+
+    SECTION("estimate")
+    {
+        for (auto i{-20000}; i <= 20000; ++i) {
+            auto const x      = static_cast<Float>(i) * Float(0.0137);
+            auto const [s, c] = neo::fast_sincos<neo::precision::estimate>(x);
+
+            // Evaluated in float, so the angle is rounded first
+            auto const rounded = static_cast<double>(static_cast<float>(x));
+            REQUIRE_THAT(s, Catch::Matchers::WithinAbs(std::sin(rounded), 1e-6));
+            REQUIRE_THAT(c, Catch::Matchers::WithinAbs(std::cos(rounded), 1e-6));
+        }
+    }
+
+    SECTION("quadrants")
+    {
+        auto const quarter = GENERATE(-4, -3, -2, -1, 0, 1, 2, 3, 4);
+        auto const [s, c]  = neo::fast_sincos(static_cast<Float>(quarter) * pi / Float(2));
+        auto const x       = static_cast<double>(quarter) * std::numbers::pi / 2.0;
+        REQUIRE_THAT(s, Catch::Matchers::WithinAbs(std::sin(x), 1e-6));
+        REQUIRE_THAT(c, Catch::Matchers::WithinAbs(std::cos(x), 1e-6));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/math: sincos", "", float, double)
+{
+    using Float = TestType;
+
+    auto const size = GENERATE(as<std::size_t>{}, 1, 7, 64, 1023);
+
+    auto angles = std::vector<Float>(size);
+    auto sin    = std::vector<Float>(size);
+    auto cos    = std::vector<Float>(size);
+    for (auto i{0zu}; i < size; ++i) {
+        angles[i] = static_cast<Float>(i) * Float(0.1) - Float(50);
+    }
+
+    neo::sincos(
+        stdex::mdspan{angles.data(), stdex::extents{size}},
+        stdex::mdspan{sin.data(), stdex::extents{size}},
+        stdex::mdspan{cos.data(), stdex::extents{size}}
+    );
+
+    for (auto i{0zu}; i < size; ++i) {
+        REQUIRE_THAT(sin[i], Catch::Matchers::WithinAbs(std::sin(angles[i]), 1e-6));
+        REQUIRE_THAT(cos[i], Catch::Matchers::WithinAbs(std::cos(angles[i]), 1e-6));
+    }
+}
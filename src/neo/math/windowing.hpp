@@ -3,13 +3,75 @@
 #pragma once
 
 #include <neo/container/mdspan.hpp>
+#include <neo/math/sincos.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <numbers>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace neo {
 
+/// Symmetric windows are meant for filter design, periodic windows for spectral analysis.
+/// A periodic window of size N is the symmetric window of size N + 1 without its last sample.
+/// \ingroup neo-math
+enum struct window_symmetry
+{
+    symmetric,
+    periodic,
+};
+
+namespace detail {
+
+/// Length of the symmetric window the samples are taken from
+[[nodiscard]] constexpr auto window_length(std::integral auto size, window_symmetry symmetry) noexcept -> std::size_t
+{
+    auto const n = static_cast<std::size_t>(size);
+    return symmetry == window_symmetry::symmetric ? n : n + 1zu;
+}
+
+/// sum_k (-1)^k * a[k] * cos(2 * pi * k * index / (length - 1))
+template<std::floating_point Float, std::size_t N>
+[[nodiscard]] auto cosine_sum(std::array<double, N> const& a, std::size_t index, std::size_t length) noexcept -> Float
+{
+    auto const x = std::numbers::pi * 2.0 * static_cast<double>(index) / static_cast<double>(length - 1zu);
+
+    auto sum = 0.0;
+    for (auto k{0zu}; k < N; ++k) {
+        auto const sign = k % 2zu == 0zu ? 1.0 : -1.0;
+        sum += sign * a[k] * std::cos(x * static_cast<double>(k));
+    }
+    return static_cast<Float>(sum);
+}
+
+/// Modified Bessel function of the first kind, order zero
+template<std::floating_point Float>
+[[nodiscard]] auto bessel_i0(Float x) noexcept -> Float
+{
+    auto const half = x / Float(2);
+    auto sum        = Float(1);
+    auto term       = Float(1);
+    for (auto k{1}; k < 256; ++k) {
+        term *= half / static_cast<Float>(k);
+        sum += term * term;
+        if (term * term < sum * std::numeric_limits<Float>::epsilon()) {
+            break;
+        }
+    }
+    return sum;
+}
+
+}  // namespace detail
+
 /// \ingroup neo-math
 template<std::floating_point Float>
 struct rectangular_window
@@ -22,6 +84,8 @@ struct rectangular_window
     {
         return Float(1.0);
     }
+
+    [[nodiscard]] auto operator==(rectangular_window const& other) const noexcept -> bool = default;
 };
 
 /// \ingroup neo-math
@@ -30,14 +94,22 @@ struct hann_window
 {
     using real_type = Float;
 
-    hann_window() noexcept = default;
+    static constexpr auto coefficients = std::array{0.5, 0.5};
+
+    explicit hann_window(window_symmetry symmetry = window_symmetry::symmetric) noexcept : _symmetry{symmetry} {}
+
+    [[nodiscard]] auto symmetry() const noexcept -> window_symmetry { return _symmetry; }
 
     [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
     {
-        auto const n      = static_cast<Float>(size - 1);
-        auto const two_pi = static_cast<Float>(std::numbers::pi) * Float(2);
-        return Float(0.5) * (Float(1) - std::cos(two_pi * static_cast<Float>(index) / n));
+        auto const i = static_cast<std::size_t>(index);
+        return detail::cosine_sum<Float>(coefficients, i, detail::window_length(size, _symmetry));
     }
+
+    [[nodiscard]] auto operator==(hann_window const& other) const noexcept -> bool = default;
+
+private:
+    window_symmetry _symmetry;
 };
 
 /// \ingroup neo-math
@@ -46,14 +118,289 @@ struct hamming_window
 {
     using real_type = Float;
 
-    hamming_window() noexcept = default;
+    static constexpr auto coefficients = std::array{0.54, 0.46};
+
+    explicit hamming_window(window_symmetry symmetry = window_symmetry::symmetric) noexcept : _symmetry{symmetry} {}
+
+    [[nodiscard]] auto symmetry() const noexcept -> window_symmetry { return _symmetry; }
+
+    [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
+    {
+        auto const i = static_cast<std::size_t>(index);
+        return detail::cosine_sum<Float>(coefficients, i, detail::window_length(size, _symmetry));
+    }
+
+    [[nodiscard]] auto operator==(hamming_window const& other) const noexcept -> bool = default;
+
+private:
+    window_symmetry _symmetry;
+};
+
+/// \ingroup neo-math
+template<std::floating_point Float>
+struct blackman_window
+{
+    using real_type = Float;
+
+    static constexpr auto coefficients = std::array{0.42, 0.5, 0.08};
+
+    explicit blackman_window(window_symmetry symmetry = window_symmetry::symmetric) noexcept : _symmetry{symmetry} {}
+
+    [[nodiscard]] auto symmetry() const noexcept -> window_symmetry { return _symmetry; }
+
+    [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
+    {
+        auto const i = static_cast<std::size_t>(index);
+        return detail::cosine_sum<Float>(coefficients, i, detail::window_length(size, _symmetry));
+    }
+
+    [[nodiscard]] auto operator==(blackman_window const& other) const noexcept -> bool = default;
+
+private:
+    window_symmetry _symmetry;
+};
+
+/// 4-term Blackman-Harris, sidelobes below -92 dB
+/// \ingroup neo-math
+template<std::floating_point Float>
+struct blackman_harris_window
+{
+    using real_type = Float;
+
+    static constexpr auto coefficients = std::array{0.35875, 0.48829, 0.14128, 0.01168};
+
+    explicit blackman_harris_window(window_symmetry symmetry = window_symmetry::symmetric) noexcept
+        : _symmetry{symmetry}
+    {}
+
+    [[nodiscard]] auto symmetry() const noexcept -> window_symmetry { return _symmetry; }
+
+    [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
+    {
+        auto const i = static_cast<std::size_t>(index);
+        return detail::cosine_sum<Float>(coefficients, i, detail::window_length(size, _symmetry));
+    }
+
+    [[nodiscard]] auto operator==(blackman_harris_window const& other) const noexcept -> bool = default;
+
+private:
+    window_symmetry _symmetry;
+};
+
+/// 4-term Nuttall with a continuous first derivative, sidelobes below -93 dB
+/// \ingroup neo-math
+template<std::floating_point Float>
+struct nuttall_window
+{
+    using real_type = Float;
+
+    static constexpr auto coefficients = std::array{0.3635819, 0.4891775, 0.1365995, 0.0106411};
+
+    explicit nuttall_window(window_symmetry symmetry = window_symmetry::symmetric) noexcept : _symmetry{symmetry} {}
+
+    [[nodiscard]] auto symmetry() const noexcept -> window_symmetry { return _symmetry; }
 
     [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
     {
-        auto const n      = static_cast<Float>(size - 1);
-        auto const two_pi = static_cast<Float>(std::numbers::pi) * Float(2);
-        return Float(0.54) - Float(0.46) * std::cos(two_pi * static_cast<Float>(index) / n);
+        auto const i = static_cast<std::size_t>(index);
+        return detail::cosine_sum<Float>(coefficients, i, detail::window_length(size, _symmetry));
     }
+
+    [[nodiscard]] auto operator==(nuttall_window const& other) const noexcept -> bool = default;
+
+private:
+    window_symmetry _symmetry;
+};
+
+/// 5-term flat-top, the passband ripple is below 0.01 dB for amplitude measurements
+/// \ingroup neo-math
+template<std::floating_point Float>
+struct flat_top_window
+{
+    using real_type = Float;
+
+    static constexpr auto coefficients = std::array{0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368};
+
+    explicit flat_top_window(window_symmetry symmetry = window_symmetry::symmetric) noexcept : _symmetry{symmetry} {}
+
+    [[nodiscard]] auto symmetry() const noexcept -> window_symmetry { return _symmetry; }
+
+    [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
+    {
+        auto const i = static_cast<std::size_t>(index);
+        return detail::cosine_sum<Float>(coefficients, i, detail::window_length(size, _symmetry));
+    }
+
+    [[nodiscard]] auto operator==(flat_top_window const& other) const noexcept -> bool = default;
+
+private:
+    window_symmetry _symmetry;
+};
+
+/// I0(beta * sqrt(1 - (2n / (N - 1) - 1)^2)) / I0(beta)
+/// \ingroup neo-math
+template<std::floating_point Float>
+struct kaiser_window
+{
+    using real_type = Float;
+
+    explicit kaiser_window(Float beta = Float(8.6), window_symmetry symmetry = window_symmetry::symmetric) noexcept
+        : _beta{beta}
+        , _symmetry{symmetry}
+    {}
+
+    [[nodiscard]] auto beta() const noexcept -> Float { return _beta; }
+
+    [[nodiscard]] auto symmetry() const noexcept -> window_symmetry { return _symmetry; }
+
+    [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
+    {
+        auto const length = detail::window_length(size, _symmetry);
+        auto const r      = 2.0 * static_cast<double>(index) / static_cast<double>(length - 1zu) - 1.0;
+        auto const beta   = static_cast<double>(_beta);
+        auto const i0     = detail::bessel_i0(beta * std::sqrt(std::max(1.0 - r * r, 0.0)));
+        return static_cast<Float>(i0 / detail::bessel_i0(beta));
+    }
+
+    [[nodiscard]] auto operator==(kaiser_window const& other) const noexcept -> bool = default;
+
+private:
+    Float _beta;
+    window_symmetry _symmetry;
+};
+
+/// Cosine tapered, alpha is the tapered fraction of the window. 0 is rectangular, 1 is hann.
+/// \ingroup neo-math
+template<std::floating_point Float>
+struct tukey_window
+{
+    using real_type = Float;
+
+    explicit tukey_window(Float alpha = Float(0.5), window_symmetry symmetry = window_symmetry::symmetric) noexcept
+        : _alpha{alpha}
+        , _symmetry{symmetry}
+    {}
+
+    [[nodiscard]] auto alpha() const noexcept -> Float { return _alpha; }
+
+    [[nodiscard]] auto symmetry() const noexcept -> window_symmetry { return _symmetry; }
+
+    [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
+    {
+        if (_alpha <= Float(0)) {
+            return Float(1);
+        }
+
+        // Distance to the closer edge, clamped to the taper
+        auto const alpha  = std::min(static_cast<double>(_alpha), 1.0);
+        auto const length = detail::window_length(size, _symmetry);
+        auto const x      = static_cast<double>(index) / static_cast<double>(length - 1zu);
+        auto const t      = std::min(std::min(x, 1.0 - x), alpha / 2.0);
+        return static_cast<Float>(0.5 * (1.0 - std::cos(std::numbers::pi * 2.0 * t / alpha)));
+    }
+
+    [[nodiscard]] auto operator==(tukey_window const& other) const noexcept -> bool = default;
+
+private:
+    Float _alpha;
+    window_symmetry _symmetry;
+};
+
+/// exp(-0.5 * ((n - c) / (sigma * c))^2) with c = (N - 1) / 2, so sigma is relative to half the window
+/// \ingroup neo-math
+template<std::floating_point Float>
+struct gaussian_window
+{
+    using real_type = Float;
+
+    explicit gaussian_window(Float sigma = Float(0.4), window_symmetry symmetry = window_symmetry::symmetric) noexcept
+        : _sigma{sigma}
+        , _symmetry{symmetry}
+    {}
+
+    [[nodiscard]] auto sigma() const noexcept -> Float { return _sigma; }
+
+    [[nodiscard]] auto symmetry() const noexcept -> window_symmetry { return _symmetry; }
+
+    [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
+    {
+        auto const center = static_cast<double>(detail::window_length(size, _symmetry) - 1zu) / 2.0;
+        auto const u      = (static_cast<double>(index) - center) / (static_cast<double>(_sigma) * center);
+        return static_cast<Float>(std::exp(-0.5 * u * u));
+    }
+
+    [[nodiscard]] auto operator==(gaussian_window const& other) const noexcept -> bool = default;
+
+private:
+    Float _sigma;
+    window_symmetry _symmetry;
+};
+
+/// sin(pi * (n + 0.5) / size), satisfies the Princen-Bradley condition for the MDCT
+/// \ingroup neo-math
+template<std::floating_point Float>
+struct sine_window
+{
+    using real_type = Float;
+
+    explicit sine_window(window_symmetry symmetry = window_symmetry::symmetric) noexcept : _symmetry{symmetry} {}
+
+    [[nodiscard]] auto symmetry() const noexcept -> window_symmetry { return _symmetry; }
+
+    [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
+    {
+        auto const length = static_cast<double>(detail::window_length(size, _symmetry));
+        return static_cast<Float>(std::sin(std::numbers::pi * (static_cast<double>(index) + 0.5) / length));
+    }
+
+    [[nodiscard]] auto operator==(sine_window const& other) const noexcept -> bool = default;
+
+private:
+    window_symmetry _symmetry;
+};
+
+/// Kaiser-Bessel-derived window, satisfies the Princen-Bradley condition for the MDCT.
+/// Evaluating a single index is linear in the size, fill_window generates the whole window in linear time.
+/// \ingroup neo-math
+template<std::floating_point Float>
+struct kbd_window
+{
+    using real_type = Float;
+
+    explicit kbd_window(Float alpha = Float(4)) noexcept : _alpha{alpha} {}
+
+    [[nodiscard]] auto alpha() const noexcept -> Float { return _alpha; }
+
+    [[nodiscard]] auto operator()(std::integral auto index, std::integral auto size) const noexcept -> Float
+    {
+        auto const n    = static_cast<std::size_t>(size);
+        auto const half = n / 2zu;
+        auto const i    = static_cast<std::size_t>(index) < half ? static_cast<std::size_t>(index)
+                                                                 : n - 1zu - static_cast<std::size_t>(index);
+
+        auto sum   = Float(0);
+        auto total = Float(0);
+        for (auto j{0zu}; j <= half; ++j) {
+            total += kaiser(j, half);
+            if (j == i) {
+                sum = total;
+            }
+        }
+        return std::sqrt(sum / total);
+    }
+
+    /// Kaiser window of length half + 1 with beta = pi * alpha
+    [[nodiscard]] auto kaiser(std::size_t index, std::size_t half) const noexcept -> Float
+    {
+        auto const pi = static_cast<Float>(std::numbers::pi);
+        auto const r  = Float(2) * static_cast<Float>(index) / static_cast<Float>(half) - Float(1);
+        return detail::bessel_i0(pi * _alpha * std::sqrt(std::max(Float(1) - r * r, Float(0))));
+    }
+
+    [[nodiscard]] auto operator==(kbd_window const& other) const noexcept -> bool = default;
+
+private:
+    Float _alpha;
 };
 
 /// \ingroup neo-math
@@ -65,6 +412,302 @@ auto fill_window(inout_vector auto vec, auto const& window)
     }
 }
 
+namespace detail {
+
+/// Cosine sum with the vectorizable sincos for the fundamental,
+/// the harmonics follow from cos(kx) = 2 * cos(x) * cos((k - 1)x) - cos((k - 2)x)
+template<inout_vector Vec, std::size_t N>
+auto fill_cosine_sum(Vec vec, std::array<double, N> const& a, window_symmetry symmetry) noexcept -> void
+{
+    using Float = value_type_t<Vec>;
+
+    auto coefficients = a;
+    for (auto k{1zu}; k < N; k += 2zu) {
+        coefficients[k] = -coefficients[k];
+    }
+
+    auto const size = static_cast<std::size_t>(vec.extent(0));
+    auto const step = std::numbers::pi * 2.0 / static_cast<double>(window_length(size, symmetry) - 1zu);
+    for (auto i{0zu}; i < size; ++i) {
+        auto const cos = fast_sincos(step * static_cast<double>(i)).second;
+
+        auto sum      = coefficients[0];
+        auto previous = 1.0;
+        auto current  = cos;
+        for (auto k{1zu}; k < N; ++k) {
+            sum += coefficients[k] * current;
+            auto const next = 2.0 * cos * current - previous;
+            previous        = current;
+            current         = next;
+        }
+        vec(i) = static_cast<Float>(sum);
+    }
+}
+
+/// Kaiser window through a power series of I0 in (x/2)^2, truncated for x = beta.
+/// Every block evaluates all samples per coefficient, so the loops vectorize.
+template<inout_vector Vec>
+auto fill_kaiser(Vec vec, double beta, std::size_t length) -> void
+{
+    using Float = value_type_t<Vec>;
+
+    static constexpr auto block_size = 64zu;
+
+    auto const max = beta * beta / 4.0;
+    auto series    = std::vector<double>{1.0};
+    auto term      = 1.0;
+    auto sum       = 1.0;
+    for (auto k{1zu}; k < 512zu; ++k) {
+        auto const scale = 1.0 / static_cast<double>(k * k);
+        term *= max * scale;
+        sum += term;
+        series.push_back(series.back() * scale);
+        if (term < sum * std::numeric_limits<double>::epsilon()) {
+            break;
+        }
+    }
+
+    auto const size = static_cast<std::size_t>(vec.extent(0));
+    auto const norm = 1.0 / sum;
+    auto const last = series.size() - 1zu;
+
+    auto y   = std::array<double, block_size>{};
+    auto acc = std::array<double, block_size>{};
+    for (auto first{0zu}; first < size; first += block_size) {
+        auto const count = std::min(block_size, size - first);
+        for (auto i{0zu}; i < count; ++i) {
+            auto const r = 2.0 * static_cast<double>(first + i) / static_cast<double>(length - 1zu) - 1.0;
+            y[i]         = max * std::max(1.0 - r * r, 0.0);
+            acc[i]       = series[last];
+        }
+        for (auto k{last}; k > 0zu; --k) {
+            auto const c = series[k - 1zu];
+            for (auto i{0zu}; i < count; ++i) {
+                acc[i] = acc[i] * y[i] + c;
+            }
+        }
+        for (auto i{0zu}; i < count; ++i) {
+            vec(first + i) = static_cast<Float>(acc[i] * norm);
+        }
+    }
+}
+
+}  // namespace detail
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, hann_window<Float> const& window) noexcept -> void
+{
+    detail::fill_cosine_sum(vec, window.coefficients, window.symmetry());
+}
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, hamming_window<Float> const& window) noexcept -> void
+{
+    detail::fill_cosine_sum(vec, window.coefficients, window.symmetry());
+}
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, blackman_window<Float> const& window) noexcept -> void
+{
+    detail::fill_cosine_sum(vec, window.coefficients, window.symmetry());
+}
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, blackman_harris_window<Float> const& window) noexcept -> void
+{
+    detail::fill_cosine_sum(vec, window.coefficients, window.symmetry());
+}
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, nuttall_window<Float> const& window) noexcept -> void
+{
+    detail::fill_cosine_sum(vec, window.coefficients, window.symmetry());
+}
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, flat_top_window<Float> const& window) noexcept -> void
+{
+    detail::fill_cosine_sum(vec, window.coefficients, window.symmetry());
+}
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, kaiser_window<Float> const& window) -> void
+{
+    auto const size = static_cast<std::size_t>(vec.extent(0));
+    detail::fill_kaiser(vec, static_cast<double>(window.beta()), detail::window_length(size, window.symmetry()));
+}
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, tukey_window<Float> const& window) noexcept -> void
+{
+    using Out = value_type_t<Vec>;
+
+    auto const size = static_cast<std::size_t>(vec.extent(0));
+    if (window.alpha() <= Float(0)) {
+        for (auto i{0zu}; i < size; ++i) {
+            vec(i) = Out(1);
+        }
+        return;
+    }
+
+    auto const alpha  = std::min(static_cast<double>(window.alpha()), 1.0);
+    auto const length = static_cast<double>(detail::window_length(size, window.symmetry()) - 1zu);
+    auto const step   = std::numbers::pi * 2.0 / alpha;
+    for (auto i{0zu}; i < size; ++i) {
+        auto const x   = static_cast<double>(i) / length;
+        auto const t   = std::min(std::min(x, 1.0 - x), alpha / 2.0);
+        auto const cos = fast_sincos(step * t).second;
+        vec(i)         = static_cast<Out>(0.5 * (1.0 - cos));
+    }
+}
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, gaussian_window<Float> const& window) noexcept -> void
+{
+    using Out = value_type_t<Vec>;
+
+    auto const size   = static_cast<std::size_t>(vec.extent(0));
+    auto const length = detail::window_length(size, window.symmetry());
+    auto const center = static_cast<double>(length - 1zu) / 2.0;
+    auto const h      = 1.0 / (static_cast<double>(window.sigma()) * center);
+
+    // Outwards from the center, so an underflow at the edges can't propagate. With u = (n - c) * h:
+    // w[n + 1] = w[n] * r[n], r[n] = exp(-(u * h + h^2 / 2)) and r[n + 1] = r[n] * exp(-h^2)
+    auto const first = length / 2zu;
+    auto const u     = (static_cast<double>(first) - center) * h;
+    auto const step  = std::exp(-h * h);
+    auto w           = std::exp(-0.5 * u * u);
+    auto r           = std::exp(-(u * h + h * h / 2.0));
+    for (auto n{first}; n < length; ++n) {
+        if (n < size) {
+            vec(n) = static_cast<Out>(w);
+        }
+        if (auto const mirror = length - 1zu - n; mirror < size) {
+            vec(mirror) = static_cast<Out>(w);
+        }
+        w *= r;
+        r *= step;
+    }
+}
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, sine_window<Float> const& window) noexcept -> void
+{
+    auto const size = static_cast<std::size_t>(vec.extent(0));
+    auto const step = std::numbers::pi / static_cast<double>(detail::window_length(size, window.symmetry()));
+    for (auto i{0zu}; i < size; ++i) {
+        vec(i) = static_cast<value_type_t<Vec>>(fast_sincos((static_cast<double>(i) + 0.5) * step).first);
+    }
+}
+
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, kbd_window<Float> const& window)
+{
+    auto const size = static_cast<std::size_t>(vec.extent(0));
+    auto const half = size / 2zu;
+
+    // Running sum of the kaiser window, mirrored into the second half
+    auto total = Float(0);
+    for (auto j{0zu}; j <= half; ++j) {
+        total += window.kaiser(j, half);
+    }
+
+    auto sum = Float(0);
+    for (auto i{0zu}; i < half; ++i) {
+        sum += window.kaiser(i, half);
+        vec(i)            = std::sqrt(sum / total);
+        vec(size - 1 - i) = vec(i);
+    }
+}
+
+/// Returns the table of the window & size, shared by all callers.
+/// Repeatedly constructed plans share the table instead of regenerating it. Per window type
+/// the window_cache_size most recently used tables are kept, a table stays alive as long as a
+/// returned pointer refers to it. Thread-safe.
+/// \ingroup neo-math
+template<typename Window>
+    requires std::equality_comparable<Window>
+[[nodiscard]] auto cached_window(Window const& window, std::size_t size)
+    -> std::shared_ptr<stdex::mdarray<typename Window::real_type, stdex::dextents<std::size_t, 1>> const>
+{
+    using Float = typename Window::real_type;
+    using Table = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>;
+
+    static constexpr auto window_cache_size = 16zu;
+
+    // Least recently used first
+    static auto mutex = std::mutex{};
+    static auto cache = std::vector<std::tuple<Window, std::size_t, std::shared_ptr<Table const>>>{};
+
+    auto const lock = std::scoped_lock{mutex};
+    auto const hit  = std::find_if(cache.begin(), cache.end(), [&window, size](auto const& entry) {
+        return std::get<1>(entry) == size and std::get<0>(entry) == window;
+    });
+    if (hit != cache.end()) {
+        std::rotate(hit, std::next(hit), cache.end());
+        return std::get<2>(cache.back());
+    }
+
+    auto table = std::make_shared<Table>(size);
+    fill_window(table->to_mdspan(), window);
+
+    if (cache.size() == window_cache_size) {
+        cache.erase(cache.begin());
+    }
+    return std::get<2>(cache.emplace_back(window, size, std::move(table)));
+}
+
+/// Windows of this library are recognized with std::function::target and copied from cached_window,
+/// everything else is evaluated per sample.
+/// \ingroup neo-math
+template<inout_vector Vec, std::floating_point Float>
+auto fill_window(Vec vec, std::function<Float(std::size_t, std::size_t)> const& window) -> void
+{
+    auto const size   = static_cast<std::size_t>(vec.extent(0));
+    auto const cached = [&vec, &window, size]<typename Window>(std::type_identity<Window> /*tag*/) {
+        auto const* const target = window.template target<Window>();
+        if (target == nullptr) {
+            return false;
+        }
+
+        auto const table = cached_window(*target, size);
+        for (auto i{0zu}; i < size; ++i) {
+            vec(i) = (*table)(i);
+        }
+        return true;
+    };
+
+    auto const found = cached(std::type_identity<rectangular_window<Float>>{})
+                    or cached(std::type_identity<hann_window<Float>>{})
+                    or cached(std::type_identity<hamming_window<Float>>{})
+                    or cached(std::type_identity<blackman_window<Float>>{})
+                    or cached(std::type_identity<blackman_harris_window<Float>>{})
+                    or cached(std::type_identity<nuttall_window<Float>>{})
+                    or cached(std::type_identity<flat_top_window<Float>>{})
+                    or cached(std::type_identity<kaiser_window<Float>>{})
+                    or cached(std::type_identity<tukey_window<Float>>{})
+                    or cached(std::type_identity<gaussian_window<Float>>{})
+                    or cached(std::type_identity<sine_window<Float>>{})
+                    or cached(std::type_identity<kbd_window<Float>>{});
+
+    if (not found) {
+        for (auto i{0zu}; i < size; ++i) {
+            vec(i) = window(i, size);
+        }
+    }
+}
+
 /// \ingroup neo-math
 template<std::floating_point Float, typename Window = hann_window<Float>>
 [[nodiscard]] auto generate_window(std::size_t length) -> stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>
@@ -74,4 +717,32 @@ template<std::floating_point Float, typename Window = hann_window<Float>>
     return buffer;
 }
 
+/// Returns true if copies of the window shifted by hop sum to a constant (constant overlap-add).
+/// For weighted overlap-add pass the product of the analysis and synthesis window.
+/// \ingroup neo-math
+template<in_vector InVec>
+[[nodiscard]] auto is_cola(InVec window, std::size_t hop, value_type_t<InVec> tolerance = value_type_t<InVec>(1e-5))
+    -> bool
+{
+    using Float = value_type_t<InVec>;
+
+    auto const size = static_cast<std::size_t>(window.extent(0));
+    if (hop == 0 or hop > size) {
+        return false;
+    }
+
+    auto min = std::numeric_limits<Float>::max();
+    auto max = std::numeric_limits<Float>::lowest();
+    for (auto n{0zu}; n < hop; ++n) {
+        auto sum = Float(0);
+        for (auto i{n}; i < size; i += hop) {
+            sum += window[i];
+        }
+        min = std::min(min, sum);
+        max = std::max(max, sum);
+    }
+
+    return max > Float(0) and (max - min) <= tolerance * max;
+}
+
 }  // namespace neo
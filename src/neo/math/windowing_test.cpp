@@ -7,6 +7,11 @@
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <array>
+#include <concepts>
+#include <functional>
+#include <tuple>
+
 TEMPLATE_TEST_CASE("neo/math: rectangular_window", "", float, double)
 {
     using Float  = TestType;
@@ -106,7 +111,17 @@ TEMPLATE_TEST_CASE("neo/math: hamming_window", "", float, double)
 TEMPLATE_PRODUCT_TEST_CASE(
     "neo/math: generate_window",
     "",
-    (neo::rectangular_window, neo::hann_window, neo::hamming_window),
+    (neo::rectangular_window,
+     neo::hann_window,
+     neo::hamming_window,
+     neo::blackman_window,
+     neo::blackman_harris_window,
+     neo::nuttall_window,
+     neo::flat_top_window,
+     neo::kaiser_window,
+     neo::tukey_window,
+     neo::gaussian_window,
+     neo::sine_window),
     (float, double)
 )
 {
@@ -118,3 +133,250 @@ TEMPLATE_PRODUCT_TEST_CASE(
     STATIC_REQUIRE(decltype(window)::rank() == 1);
     REQUIRE(window.extent(0) == size);
 }
+
+namespace {
+
+template<typename Window>
+auto test_window(std::array<double, 8> const& expected) -> void
+{
+    auto const window = Window{};
+    for (auto i{0zu}; i < expected.size(); ++i) {
+        REQUIRE_THAT(window(i, expected.size()), Catch::Matchers::WithinAbs(expected[i], 0.00001));
+    }
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/math: cosine sum windows", "", float, double)
+{
+    using Float = TestType;
+
+    SECTION("compare with scipy.signal.windows.blackman(8)")
+    {
+        test_window<neo::blackman_window<Float>>(
+            {0.0, 0.09045342, 0.45918296, 0.92036362, 0.92036362, 0.45918296, 0.09045342, 0.0}
+        );
+    }
+
+    SECTION("compare with scipy.signal.windows.blackmanharris(8)")
+    {
+        test_window<neo::blackman_harris_window<Float>>(
+            {0.00006, 0.03339172, 0.3328335, 0.88936977, 0.88936977, 0.3328335, 0.03339172, 0.00006}
+        );
+    }
+
+    SECTION("compare with scipy.signal.windows.nuttall(8)")
+    {
+        test_window<neo::nuttall_window<Float>>(
+            {0.0003628, 0.03777577, 0.34272762, 0.89185186, 0.89185186, 0.34272762, 0.03777577, 0.0003628}
+        );
+    }
+
+    SECTION("compare with scipy.signal.windows.flattop(8)")
+    {
+        test_window<neo::flat_top_window<Float>>(
+            {-0.00042105, -0.03684078, 0.01070372, 0.78087391, 0.78087391, 0.01070372, -0.03684078, -0.00042105}
+        );
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/math: kaiser_window", "", float, double)
+{
+    using Float = TestType;
+
+    // numpy.kaiser(8, 8.6)
+    test_window<neo::kaiser_window<Float>>(
+        {0.00133251, 0.09113651, 0.45964377, 0.92046158, 0.92046158, 0.45964377, 0.09113651, 0.00133251}
+    );
+
+    auto const rect = neo::kaiser_window<Float>{Float(0)};
+    REQUIRE(rect.beta() == Float(0));
+    REQUIRE_THAT(rect(0, 16), Catch::Matchers::WithinAbs(1.0, 0.00001));
+    REQUIRE_THAT(rect(7, 16), Catch::Matchers::WithinAbs(1.0, 0.00001));
+}
+
+TEMPLATE_TEST_CASE("neo/math: tukey_window", "", float, double)
+{
+    using Float = TestType;
+
+    // scipy.signal.windows.tukey(8, 0.5)
+    test_window<neo::tukey_window<Float>>({0.0, 0.61126047, 1.0, 1.0, 1.0, 1.0, 0.61126047, 0.0});
+
+    auto const size = 16;
+    auto const rect = neo::tukey_window<Float>{Float(0)};
+    auto const hann = neo::tukey_window<Float>{Float(1)};
+    REQUIRE(hann.alpha() == Float(1));
+    for (auto i{0}; i < size; ++i) {
+        REQUIRE(rect(i, size) == Float(1));
+        REQUIRE_THAT(hann(i, size), Catch::Matchers::WithinAbs(neo::hann_window<Float>{}(i, size), 0.00001));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/math: gaussian_window", "", float, double)
+{
+    using Float = TestType;
+
+    // scipy.signal.windows.gaussian(8, std=0.4 * 3.5)
+    test_window<neo::gaussian_window<Float>>(
+        {0.04393693, 0.2030328, 0.56327935, 0.9382156, 0.9382156, 0.56327935, 0.2030328, 0.04393693}
+    );
+    REQUIRE(neo::gaussian_window<Float>{Float(0.25)}.sigma() == Float(0.25));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/math: fill_window",
+    "",
+    (neo::rectangular_window,
+     neo::hann_window,
+     neo::hamming_window,
+     neo::blackman_window,
+     neo::blackman_harris_window,
+     neo::nuttall_window,
+     neo::flat_top_window,
+     neo::kaiser_window,
+     neo::tukey_window,
+     neo::gaussian_window,
+     neo::sine_window),
+    (float, double)
+)
+{
+    using Window = TestType;
+    using Float  = typename Window::real_type;
+
+    auto const size     = GENERATE(as<std::size_t>{}, 2, 15, 128, 1024);
+    auto const symmetry = GENERATE(neo::window_symmetry::symmetric, neo::window_symmetry::periodic);
+    auto const window   = [symmetry] {
+        if constexpr (std::constructible_from<Window, neo::window_symmetry>) {
+            return Window{symmetry};
+        } else if constexpr (std::constructible_from<Window, Float, neo::window_symmetry>) {
+            return Window{Float(0.5), symmetry};
+        } else {
+            return Window{};
+        }
+    }();
+
+    auto buffer = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+    neo::fill_window(buffer.to_mdspan(), window);
+
+    // The vectorized fill matches the functor
+    for (auto i{0zu}; i < size; ++i) {
+        REQUIRE_THAT(buffer(i), Catch::Matchers::WithinAbs(window(i, size), 0.00001));
+    }
+
+    // Periodic windows are the symmetric window one sample longer, truncated
+    if constexpr (std::constructible_from<Window, neo::window_symmetry>) {
+        if (symmetry == neo::window_symmetry::periodic) {
+            auto const symmetric = Window{neo::window_symmetry::symmetric};
+            for (auto i{0zu}; i < size; ++i) {
+                REQUIRE_THAT(buffer(i), Catch::Matchers::WithinAbs(symmetric(i, size + 1), 0.00001));
+            }
+        }
+    }
+
+    // Plans take the window as a std::function, which is served by cached_window
+    auto const function = std::function<Float(std::size_t, std::size_t)>{window};
+    auto erased         = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+    neo::fill_window(erased.to_mdspan(), function);
+    for (auto i{0zu}; i < size; ++i) {
+        REQUIRE(erased(i) == buffer(i));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/math: cached_window", "", float, double)
+{
+    using Float = TestType;
+
+    auto const hann     = neo::cached_window(neo::hann_window<Float>{}, 64);
+    auto const periodic = neo::cached_window(neo::hann_window<Float>{neo::window_symmetry::periodic}, 64);
+    auto const kaiser   = neo::cached_window(neo::kaiser_window<Float>{Float(4)}, 64);
+    REQUIRE(hann->extent(0) == 64);
+    REQUIRE(periodic->extent(0) == 64);
+
+    // Same window & size share the table
+    REQUIRE(neo::cached_window(neo::hann_window<Float>{}, 64) == hann);
+    REQUIRE(neo::cached_window(neo::kaiser_window<Float>{Float(4)}, 64) == kaiser);
+    REQUIRE(neo::cached_window(neo::hann_window<Float>{}, 65) != hann);
+    REQUIRE(neo::cached_window(neo::kaiser_window<Float>{Float(5)}, 64) != kaiser);
+    REQUIRE(periodic != hann);
+
+    for (auto i{0zu}; i < 64zu; ++i) {
+        REQUIRE((*hann)(i) == Catch::Approx(neo::hann_window<Float>{}(i, 64zu)).margin(0.00001));
+        REQUIRE((*periodic)(i) == Catch::Approx(neo::hann_window<Float>{}(i, 65zu)).margin(0.00001));
+    }
+
+    // A parameter sweep evicts old tables, the ones still referenced stay valid
+    for (auto beta{0}; beta < 100; ++beta) {
+        std::ignore = neo::cached_window(neo::kaiser_window<Float>{Float(10) + static_cast<Float>(beta)}, 64);
+    }
+    REQUIRE(kaiser.use_count() == 1);
+    REQUIRE(neo::cached_window(neo::kaiser_window<Float>{Float(4)}, 64) != kaiser);
+    for (auto i{0zu}; i < 64zu; ++i) {
+        REQUIRE((*kaiser)(i) == Catch::Approx(neo::kaiser_window<Float>{Float(4)}(i, 64zu)).margin(0.00001));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/math: is_cola", "", float, double)
+{
+    using Float = TestType;
+
+    auto const size   = GENERATE(as<std::size_t>{}, 64, 256, 1024);
+    auto const hann   = neo::generate_window<Float, neo::hann_window<Float>>(size);
+    auto const rect   = neo::generate_window<Float, neo::rectangular_window<Float>>(size);
+    auto const period = [size] {
+        auto window = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+        neo::fill_window(window.to_mdspan(), [](auto i, auto n) { return neo::hann_window<Float>{}(i, n + 1); });
+        return window;
+    }();
+
+    REQUIRE(neo::is_cola(rect.to_mdspan(), size));
+    REQUIRE(neo::is_cola(rect.to_mdspan(), size / 4));
+    REQUIRE_FALSE(neo::is_cola(rect.to_mdspan(), size / 2 + 1));
+    REQUIRE_FALSE(neo::is_cola(rect.to_mdspan(), 0));
+    REQUIRE_FALSE(neo::is_cola(rect.to_mdspan(), size + 1));
+
+    REQUIRE(neo::is_cola(period.to_mdspan(), size / 2));
+    REQUIRE(neo::is_cola(period.to_mdspan(), size / 4));
+    REQUIRE_FALSE(neo::is_cola(period.to_mdspan(), size));
+    REQUIRE_FALSE(neo::is_cola(hann.to_mdspan(), size / 2));
+}
+
+TEMPLATE_TEST_CASE("neo/math: sine_window", "", float, double)
+{
+    using Float = TestType;
+
+    auto const size   = GENERATE(as<std::size_t>{}, 2, 16, 256, 1024);
+    auto const window = neo::sine_window<Float>{};
+    auto const half   = size / 2zu;
+
+    // Princen-Bradley condition
+    for (auto i{0zu}; i < half; ++i) {
+        auto const sum = window(i, size) * window(i, size) + window(i + half, size) * window(i + half, size);
+        REQUIRE_THAT(sum, Catch::Matchers::WithinAbs(1.0, 0.00001));
+        REQUIRE_THAT(window(i, size), Catch::Matchers::WithinAbs(window(size - 1 - i, size), 0.00001));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/math: kbd_window", "", float, double)
+{
+    using Float = TestType;
+
+    auto const size   = GENERATE(as<std::size_t>{}, 2, 16, 256, 1024);
+    auto const alpha  = GENERATE(Float(2), Float(4), Float(6));
+    auto const window = neo::kbd_window<Float>{alpha};
+    auto const half   = size / 2zu;
+    REQUIRE(window.alpha() == alpha);
+
+    auto buffer = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+    neo::fill_window(buffer.to_mdspan(), window);
+
+    for (auto i{0zu}; i < half; ++i) {
+        // Princen-Bradley condition
+        auto const sum = buffer(i) * buffer(i) + buffer(i + half) * buffer(i + half);
+        REQUIRE_THAT(sum, Catch::Matchers::WithinAbs(1.0, 0.00001));
+        REQUIRE(buffer(i) == buffer(size - 1 - i));
+
+        // The linear time fill matches the functor
+        REQUIRE_THAT(buffer(i), Catch::Matchers::WithinAbs(window(i, size), 0.00001));
+        REQUIRE_THAT(buffer(i + half), Catch::Matchers::WithinAbs(window(i + half, size), 0.00001));
+    }
+}
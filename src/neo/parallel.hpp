@@ -0,0 +1,10 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+/// \defgroup neo-parallel Parallel
+/// Thread pool for real-time use
+
+#include <neo/parallel/thread_pool.hpp>
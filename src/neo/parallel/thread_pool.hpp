@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(NEO_PLATFORM_LINUX)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace neo {
+
+namespace detail {
+
+/// Pins the calling thread to a single cpu, returns false if not supported
+inline auto pin_current_thread(std::size_t cpu) noexcept -> bool
+{
+#if defined(NEO_PLATFORM_LINUX)
+    auto set = cpu_set_t{};
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+}  // namespace detail
+
+/// Fixed size work-stealing thread pool for real-time use.
+///
+/// parallel_for splits the index range evenly over all workers and the calling
+/// thread, which takes part in the work. Idle threads steal half of the remaining
+/// range of another thread. Submitting does not allocate or lock. Workers spin
+/// for a short time before going to sleep, so back-to-back calls (one per audio
+/// block) are picked up without a wake-up delay.
+///
+/// Only one thread may call parallel_for at a time and the callback must not throw.
+///
+/// \ingroup neo-parallel
+struct thread_pool
+{
+    /// One less than the number of hardware threads, the calling thread is the last participant
+    [[nodiscard]] static auto default_num_workers() noexcept -> std::size_t
+    {
+        return std::max(std::thread::hardware_concurrency(), 1U) - 1U;
+    }
+
+    explicit thread_pool(std::size_t num_workers = default_num_workers(), bool pin_workers = true);
+    ~thread_pool();
+
+    thread_pool(thread_pool const& other)                    = delete;
+    auto operator=(thread_pool const& other) -> thread_pool& = delete;
+
+    /// Number of workers plus the calling thread
+    [[nodiscard]] auto concurrency() const noexcept -> std::size_t { return _workers.size() + 1zu; }
+
+    /// Calls func(worker, index) for every index in [0, count). worker is in [0, concurrency())
+    /// and can be used to select per-thread scratch memory. Returns once all calls have finished.
+    template<typename Func>
+    auto parallel_for(std::size_t count, Func&& func) -> void;
+
+private:
+    static constexpr auto spin_count = 1U << 14U;
+
+    struct alignas(64) queue
+    {
+        // [begin, end) packed into the lower and upper 32 bit, so pop & steal are a single CAS
+        std::atomic<std::uint64_t> range{0};
+    };
+
+    [[nodiscard]] static constexpr auto pack(std::uint64_t begin, std::uint64_t end) noexcept -> std::uint64_t
+    {
+        return begin | (end << 32U);
+    }
+
+    auto worker(std::size_t self) -> void;
+    auto run(std::size_t self) -> void;
+    auto pop(std::size_t self, std::size_t& index) -> bool;
+    auto steal(std::size_t self) -> bool;
+
+    void const* _context{nullptr};
+    void (*_invoke)(void const*, std::size_t, std::size_t){nullptr};
+
+    std::unique_ptr<queue[]> _queues;
+    std::atomic<std::uint32_t> _generation{0};
+    std::atomic<std::size_t> _busy{0};
+    std::atomic<bool> _stop{false};
+    std::vector<std::jthread> _workers;
+};
+
+inline thread_pool::thread_pool(std::size_t num_workers, bool pin_workers)
+    : _queues{std::make_unique<queue[]>(num_workers + 1zu)}
+{
+    auto const num_cpus = std::max(std::thread::hardware_concurrency(), 1U);
+
+    _workers.reserve(num_workers);
+    for (auto i{0zu}; i < num_workers; ++i) {
+        _workers.emplace_back([this, i, pin_workers, num_cpus] {
+            if (pin_workers) {
+                // Leave the first cpu to the calling (audio) thread
+                detail::pin_current_thread((i + 1zu) % num_cpus);
+            }
+            worker(i);
+        });
+    }
+}
+
+inline thread_pool::~thread_pool()
+{
+    _stop.store(true, std::memory_order_release);
+    _generation.fetch_add(1, std::memory_order_release);
+    _generation.notify_all();
+}
+
+template<typename Func>
+auto thread_pool::parallel_for(std::size_t count, Func&& func) -> void
+{
+    using Callback = std::remove_reference_t<Func>;
+
+    if (count == 0) {
+        return;
+    }
+
+    if (_workers.empty() or count == 1) {
+        for (auto i{0zu}; i < count; ++i) {
+            func(0zu, i);
+        }
+        return;
+    }
+
+    assert(count <= std::numeric_limits<std::uint32_t>::max());
+    assert(_busy.load() == 0);
+
+    _context = static_cast<void const*>(std::addressof(func));
+    _invoke  = [](void const* context, std::size_t worker, std::size_t index) {
+        (*static_cast<Callback*>(const_cast<void*>(context)))(worker, index);
+    };
+
+    auto const n = concurrency();
+    for (auto i{0zu}; i < n; ++i) {
+        _queues[i].range.store(pack(count * i / n, count * (i + 1zu) / n), std::memory_order_relaxed);
+    }
+
+    _busy.store(_workers.size(), std::memory_order_relaxed);
+    _generation.fetch_add(1, std::memory_order_release);
+    _generation.notify_all();
+
+    run(_workers.size());
+
+    for (auto busy = _busy.load(std::memory_order_acquire); busy != 0; busy = _busy.load(std::memory_order_acquire)) {
+        _busy.wait(busy, std::memory_order_acquire);
+    }
+}
+
+inline auto thread_pool::worker(std::size_t self) -> void
+{
+    // Workers are started before the first job, a job might already be queued by the time the thread runs
+    auto seen = std::uint32_t{0};
+
+    while (not _stop.load(std::memory_order_acquire)) {
+        for (auto i{0U}; i < spin_count and _generation.load(std::memory_order_relaxed) == seen; ++i) {}
+        _generation.wait(seen, std::memory_order_acquire);
+        seen = _generation.load(std::memory_order_acquire);
+
+        if (_stop.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        run(self);
+
+        if (_busy.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            _busy.notify_one();
+        }
+    }
+}
+
+inline auto thread_pool::run(std::size_t self) -> void
+{
+    auto index = 0zu;
+    do {
+        while (pop(self, index)) {
+            _invoke(_context, self, index);
+        }
+    } while (steal(self));
+}
+
+inline auto thread_pool::pop(std::size_t self, std::size_t& index) -> bool
+{
+    auto& range  = _queues[self].range;
+    auto current = range.load(std::memory_order_relaxed);
+
+    while (true) {
+        auto const begin = current & 0xFFFF'FFFFU;
+        auto const end   = current >> 32U;
+        if (begin >= end) {
+            return false;
+        }
+        if (range.compare_exchange_weak(current, pack(begin + 1U, end), std::memory_order_acq_rel)) {
+            index = static_cast<std::size_t>(begin);
+            return true;
+        }
+    }
+}
+
+inline auto thread_pool::steal(std::size_t self) -> bool
+{
+    auto const n = concurrency();
+
+    for (auto offset{1zu}; offset < n; ++offset) {
+        auto& range  = _queues[(self + offset) % n].range;
+        auto current = range.load(std::memory_order_relaxed);
+
+        while (true) {
+            auto const begin = current & 0xFFFF'FFFFU;
+            auto const end   = current >> 32U;
+            if (begin >= end) {
+                break;
+            }
+
+            // Take the upper half, the owner keeps popping from the front
+            auto const split = end - (end - begin + 1U) / 2U;
+            if (range.compare_exchange_weak(current, pack(begin, split), std::memory_order_acq_rel)) {
+                _queues[self].range.store(pack(split, end), std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+}  // namespace neo
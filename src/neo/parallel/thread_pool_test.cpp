@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+
+#include "thread_pool.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST_CASE("neo/parallel: thread_pool")
+{
+    auto const num_workers = GENERATE(as<std::size_t>{}, 0, 1, 3, 7);
+    auto const pin_workers = GENERATE(false, true);
+    CAPTURE(num_workers);
+    CAPTURE(pin_workers);
+
+    auto pool = neo::thread_pool{num_workers, pin_workers};
+    REQUIRE(pool.concurrency() == num_workers + 1);
+
+    pool.parallel_for(0, [](std::size_t, std::size_t) { FAIL("called for empty range"); });
+
+    auto const count = GENERATE(as<std::size_t>{}, 1, 2, 7, 100, 10'000);
+    CAPTURE(count);
+
+    auto calls       = std::vector<std::atomic<int>>(count);
+    auto bad_workers = std::atomic<int>{0};
+
+    for (auto run{0}; run < 10; ++run) {
+        pool.parallel_for(count, [&](std::size_t worker, std::size_t index) {
+            if (worker >= pool.concurrency()) {
+                ++bad_workers;
+            }
+            calls[index].fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+
+    REQUIRE(bad_workers.load() == 0);
+    for (auto const& c : calls) {
+        REQUIRE(c.load() == 10);
+    }
+}
+
+TEST_CASE("neo/parallel: thread_pool(unbalanced)")
+{
+    auto pool = neo::thread_pool{3, false};
+
+    // All slow items start in the range of the calling thread, the workers have to steal them
+    auto calls = std::vector<std::atomic<int>>(64);
+    pool.parallel_for(calls.size(), [&](std::size_t, std::size_t index) {
+        if (index < 16) {
+            std::this_thread::sleep_for(std::chrono::microseconds{200});
+        }
+        calls[index].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    for (auto const& c : calls) {
+        REQUIRE(c.load() == 1);
+    }
+}
@@ -2,12 +2,18 @@
 
 #pragma once
 
+#include <neo/container/mdspan.hpp>
 #include <neo/math/fast_math.hpp>
 #include <neo/math/precision.hpp>
 
 #include <algorithm>
+#include <bit>
+#include <cassert>
 #include <cmath>
 #include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numbers>
 
 namespace neo {
 
@@ -30,4 +36,100 @@ template<precision Precision = precision::accurate, std::floating_point Float>
     return amplitude_to_db<Precision>(gain, Float(-144));
 }
 
+namespace detail {
+
+/// out = max(floor, scale * log10(x)), the floor is applied before the log so the loop has no branches
+template<precision Precision, in_object InObj, out_object OutObj>
+    requires(InObj::rank() == OutObj::rank())
+auto scaled_log10(InObj x, OutObj out, value_type_t<OutObj> scale, value_type_t<OutObj> floor) noexcept -> void
+{
+    using Float = value_type_t<OutObj>;
+
+    assert(detail::extents_equal(x, out));
+
+    if constexpr (InObj::rank() == 2) {
+        for (auto row{0zu}; row < static_cast<std::size_t>(x.extent(0)); ++row) {
+            auto const in = stdex::submdspan(x, row, stdex::full_extent);
+            scaled_log10<Precision>(in, stdex::submdspan(out, row, stdex::full_extent), scale, floor);
+        }
+    } else if constexpr (Precision == precision::accurate) {
+        auto const min = std::pow(Float(10), floor / scale);
+        for (auto i{0zu}; i < static_cast<std::size_t>(x.extent(0)); ++i) {
+            out[i] = scale * std::log10(std::max(static_cast<Float>(x[i]), min));
+        }
+    } else {
+        auto const limit  = std::pow(10.0F, static_cast<float>(floor / scale));
+        auto const min    = std::bit_cast<std::int32_t>(std::max(limit, std::numeric_limits<float>::min()));
+        auto const factor = static_cast<float>(scale) * std::numbers::ln2_v<float> / std::numbers::ln10_v<float>;
+
+        // Positive floats order like their bit patterns, negative ones compare below any positive one.
+        // Clamping the integers keeps GCC from turning the max into a branch, so the loop vectorizes.
+        for (auto i{0zu}; i < static_cast<std::size_t>(x.extent(0)); ++i) {
+            auto const bits    = std::max(std::bit_cast<std::int32_t>(static_cast<float>(x[i])), min);
+            auto const clamped = std::bit_cast<float>(bits);
+            out[i]             = static_cast<Float>(factor * fast_log2_polynomial(clamped));
+        }
+    }
+}
+
+/// out = 10^(x / scale)
+template<precision Precision, in_object InObj, out_object OutObj>
+    requires(InObj::rank() == OutObj::rank())
+auto scaled_exp10(InObj x, OutObj out, value_type_t<OutObj> scale) noexcept -> void
+{
+    using Float = value_type_t<OutObj>;
+
+    assert(detail::extents_equal(x, out));
+
+    if constexpr (InObj::rank() == 2) {
+        for (auto row{0zu}; row < static_cast<std::size_t>(x.extent(0)); ++row) {
+            auto const in = stdex::submdspan(x, row, stdex::full_extent);
+            scaled_exp10<Precision>(in, stdex::submdspan(out, row, stdex::full_extent), scale);
+        }
+    } else if constexpr (Precision == precision::accurate) {
+        for (auto i{0zu}; i < static_cast<std::size_t>(x.extent(0)); ++i) {
+            out[i] = std::pow(Float(10), static_cast<Float>(x[i]) / scale);
+        }
+    } else {
+        auto const factor = std::numbers::ln10_v<float> / std::numbers::ln2_v<float> / static_cast<float>(scale);
+        for (auto i{0zu}; i < static_cast<std::size_t>(x.extent(0)); ++i) {
+            out[i] = static_cast<Float>(fast_exp2(static_cast<float>(x[i]) * factor));
+        }
+    }
+}
+
+}  // namespace detail
+
+/// out = max(floor, 20 * log10(gain)), element-wise over a vector or matrix
+template<precision Precision = precision::accurate, in_object InObj, out_object OutObj>
+    requires(InObj::rank() == OutObj::rank() and std::floating_point<value_type_t<OutObj>>)
+auto amplitude_to_db(InObj gains, OutObj out, value_type_t<OutObj> floor = value_type_t<OutObj>(-144)) noexcept -> void
+{
+    detail::scaled_log10<Precision>(gains, out, value_type_t<OutObj>(20), floor);
+}
+
+/// out = 10^(db / 20), element-wise over a vector or matrix
+template<precision Precision = precision::accurate, in_object InObj, out_object OutObj>
+    requires(InObj::rank() == OutObj::rank() and std::floating_point<value_type_t<OutObj>>)
+auto db_to_amplitude(InObj db, OutObj out) noexcept -> void
+{
+    detail::scaled_exp10<Precision>(db, out, value_type_t<OutObj>(20));
+}
+
+/// out = max(floor, 10 * log10(power)), element-wise over a vector or matrix
+template<precision Precision = precision::accurate, in_object InObj, out_object OutObj>
+    requires(InObj::rank() == OutObj::rank() and std::floating_point<value_type_t<OutObj>>)
+auto power_to_db(InObj power, OutObj out, value_type_t<OutObj> floor = value_type_t<OutObj>(-144)) noexcept -> void
+{
+    detail::scaled_log10<Precision>(power, out, value_type_t<OutObj>(10), floor);
+}
+
+/// out = 10^(db / 10), element-wise over a vector or matrix
+template<precision Precision = precision::accurate, in_object InObj, out_object OutObj>
+    requires(InObj::rank() == OutObj::rank() and std::floating_point<value_type_t<OutObj>>)
+auto db_to_power(InObj db, OutObj out) noexcept -> void
+{
+    detail::scaled_exp10<Precision>(db, out, value_type_t<OutObj>(10));
+}
+
 }  // namespace neo
@@ -5,6 +5,9 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
 
 TEMPLATE_TEST_CASE("neo/math: amplitude_to_db<precision::accurate>", "", float, double)
 {
@@ -34,3 +37,72 @@ TEMPLATE_TEST_CASE("neo/math: amplitude_to_db<precision::estimate>", "", float,
     REQUIRE(neo::amplitude_to_db<neo::precision::estimate>(Float(0), Float(-50.0)) == Catch::Approx(-50.0));
     REQUIRE(neo::amplitude_to_db<neo::precision::estimate>(Float(0.00001), Float(-50.0)) == Catch::Approx(-50.0));
 }
+
+TEMPLATE_TEST_CASE("neo/unit: amplitude_to_db(span)", "", float, double)
+{
+    using Float = TestType;
+
+    // Gains over the whole range, including zero, negative & values below the floor
+    auto gains = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{403zu};
+    for (auto i{0zu}; i < gains.extent(0); ++i) {
+        gains(i) = std::pow(Float(10), static_cast<Float>(i) * Float(-0.02) + Float(1));
+    }
+    gains(401) = Float(0);
+    gains(402) = Float(-1);
+
+    auto accurate = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{gains.extent(0)};
+    auto estimate = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{gains.extent(0)};
+    neo::amplitude_to_db(gains.to_mdspan(), accurate.to_mdspan(), Float(-100));
+    neo::amplitude_to_db<neo::precision::estimate>(gains.to_mdspan(), estimate.to_mdspan(), Float(-100));
+
+    for (auto i{0zu}; i < gains.extent(0); ++i) {
+        auto const expected = std::max(neo::amplitude_to_db(gains(i), Float(-100)), Float(-100));
+        REQUIRE_THAT(accurate(i), Catch::Matchers::WithinAbs(expected, 0.0001));
+        REQUIRE_THAT(estimate(i), Catch::Matchers::WithinAbs(expected, 0.001));
+    }
+
+    // Round trip
+    auto amplitude = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{gains.extent(0)};
+    neo::db_to_amplitude(accurate.to_mdspan(), amplitude.to_mdspan());
+    for (auto i{0zu}; i < 300zu; ++i) {
+        REQUIRE_THAT(amplitude(i), Catch::Matchers::WithinRel(gains(i), Float(0.0001)));
+    }
+
+    neo::db_to_amplitude<neo::precision::estimate>(estimate.to_mdspan(), amplitude.to_mdspan());
+    for (auto i{0zu}; i < 300zu; ++i) {
+        REQUIRE_THAT(amplitude(i), Catch::Matchers::WithinRel(gains(i), Float(0.001)));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/unit: power_to_db(span)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const rows = GENERATE(as<std::size_t>{}, 1, 3);
+    auto const cols = GENERATE(as<std::size_t>{}, 1, 15, 257);
+
+    auto power = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{rows, cols};
+    for (auto row{0zu}; row < rows; ++row) {
+        for (auto col{0zu}; col < cols; ++col) {
+            power(row, col) = std::pow(Float(10), -static_cast<Float>(row * cols + col) * Float(0.05));
+        }
+    }
+
+    auto accurate = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{rows, cols};
+    auto estimate = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{rows, cols};
+    neo::power_to_db(power.to_mdspan(), accurate.to_mdspan(), Float(-72));
+    neo::power_to_db<neo::precision::estimate>(power.to_mdspan(), estimate.to_mdspan(), Float(-72));
+
+    auto linear = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{rows, cols};
+    neo::db_to_power<neo::precision::estimate>(accurate.to_mdspan(), linear.to_mdspan());
+
+    for (auto row{0zu}; row < rows; ++row) {
+        for (auto col{0zu}; col < cols; ++col) {
+            auto const expected = std::max(Float(10) * std::log10(power(row, col)), Float(-72));
+            auto const floored  = std::pow(Float(10), expected / Float(10));
+            REQUIRE_THAT(accurate(row, col), Catch::Matchers::WithinAbs(expected, 0.0001));
+            REQUIRE_THAT(estimate(row, col), Catch::Matchers::WithinAbs(expected, 0.001));
+            REQUIRE_THAT(linear(row, col), Catch::Matchers::WithinRel(floored, Float(0.0001)));
+        }
+    }
+}